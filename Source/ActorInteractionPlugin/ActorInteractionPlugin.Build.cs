@@ -31,7 +31,8 @@ public class ActorInteractionPlugin : ModuleRules
 				"Core",
 				"UMG",
 				"InputCore",
-				"Engine"
+				"Engine",
+				"AIModule"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -0,0 +1,109 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "AI/EnvQueryGenerator_Interactables.h"
+
+#include "Engine/Engine.h"
+#include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_Actor.h"
+
+#include "Components/ActorInteractableComponentBase.h"
+#include "Helpers/ActorInteractionPluginStats.h"
+#include "Subsystems/ActorInteractableRegistrySubsystem.h"
+
+#define LOCTEXT_NAMESPACE "EnvQueryGenerator_Interactables"
+
+DECLARE_CYCLE_STAT(TEXT("EQS Interactables Generator"), STAT_InteractionEQSGenerator, STATGROUP_MounteaInteraction);
+
+UEnvQueryGenerator_Interactables::UEnvQueryGenerator_Interactables(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	ItemType = UEnvQueryItemType_Actor::StaticClass();
+
+	SearchCenter = UEnvQueryContext_Querier::StaticClass();
+	SearchRadius.DefaultValue = 1500.f;
+
+	bOnlyTriggerable = true;
+
+	bFilterByCollisionChannel = false;
+	CollisionChannel = ECC_Camera;
+
+	bFilterByWeight = false;
+	MinimumWeight = 0;
+}
+
+void UEnvQueryGenerator_Interactables::GenerateItems(FEnvQueryInstance& QueryInstance) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionEQSGenerator);
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(QueryInstance.Owner.Get(), EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr) return;
+
+	const UActorInteractableRegistrySubsystem* Registry = World->GetSubsystem<UActorInteractableRegistrySubsystem>();
+	if (Registry == nullptr) return;
+
+	SearchRadius.BindData(QueryInstance.Owner.Get(), QueryInstance.QueryID);
+	const float RadiusValue = FMath::Max(0.f, SearchRadius.GetValue());
+
+	TArray<FVector> ContextLocations;
+	QueryInstance.PrepareContext(SearchCenter, ContextLocations);
+
+	TArray<UActorInteractableComponentBase*> FoundInteractables;
+	for (const FVector& Itr : ContextLocations)
+	{
+		Registry->QueryRadius(Itr, RadiusValue, FoundInteractables);
+	}
+
+	TArray<AActor*> MatchingActors;
+	MatchingActors.Reserve(FoundInteractables.Num());
+
+	for (const UActorInteractableComponentBase* Itr : FoundInteractables)
+	{
+		if (!PassesFilters(Itr)) continue;
+
+		// One Actor can own multiple Interactables and multiple contexts can find same Interactable
+		if (AActor* Owner = Itr->GetOwner())
+		{
+			MatchingActors.AddUnique(Owner);
+		}
+	}
+
+	QueryInstance.AddItemData<UEnvQueryItemType_Actor>(MatchingActors);
+}
+
+bool UEnvQueryGenerator_Interactables::PassesFilters(const UActorInteractableComponentBase* Interactable) const
+{
+	if (Interactable == nullptr) return false;
+
+	if (bOnlyTriggerable && !Interactable->CanBeTriggered()) return false;
+	if (bFilterByCollisionChannel && Interactable->GetCollisionChannel() != CollisionChannel) return false;
+	if (bFilterByWeight && Interactable->GetInteractableWeight() < MinimumWeight) return false;
+
+	return true;
+}
+
+FText UEnvQueryGenerator_Interactables::GetDescriptionTitle() const
+{
+	return FText::Format(LOCTEXT("DescriptionTitle", "Interactables around {0}"), UEnvQueryTypes::DescribeContext(SearchCenter));
+}
+
+FText UEnvQueryGenerator_Interactables::GetDescriptionDetails() const
+{
+	FText Description = FText::Format(LOCTEXT("DescriptionRadius", "radius: {0}"), FText::FromString(SearchRadius.ToString()));
+
+	if (bOnlyTriggerable)
+	{
+		Description = FText::Format(LOCTEXT("DescriptionTriggerable", "{0}, only triggerable"), Description);
+	}
+	if (bFilterByCollisionChannel)
+	{
+		Description = FText::Format(LOCTEXT("DescriptionChannel", "{0}, channel: {1}"), Description, UEnum::GetDisplayValueAsText(CollisionChannel.GetValue()));
+	}
+	if (bFilterByWeight)
+	{
+		Description = FText::Format(LOCTEXT("DescriptionWeight", "{0}, weight >= {1}"), Description, FText::AsNumber(MinimumWeight));
+	}
+
+	return Description;
+}
+
+#undef LOCTEXT_NAMESPACE
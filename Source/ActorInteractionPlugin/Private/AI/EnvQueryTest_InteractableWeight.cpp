@@ -0,0 +1,65 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "AI/EnvQueryTest_InteractableWeight.h"
+
+#include "EnvironmentQuery/Items/EnvQueryItemType_ActorBase.h"
+
+#include "Components/ActorInteractableComponentBase.h"
+
+#define LOCTEXT_NAMESPACE "EnvQueryTest_InteractableWeight"
+
+UEnvQueryTest_InteractableWeight::UEnvQueryTest_InteractableWeight(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	Cost = EEnvTestCost::Low;
+	ValidItemType = UEnvQueryItemType_ActorBase::StaticClass();
+	SetWorkOnFloatValues(true);
+}
+
+void UEnvQueryTest_InteractableWeight::RunTest(FEnvQueryInstance& QueryInstance) const
+{
+	UObject* QueryOwner = QueryInstance.Owner.Get();
+	if (QueryOwner == nullptr) return;
+
+	FloatValueMin.BindData(QueryOwner, QueryInstance.QueryID);
+	FloatValueMax.BindData(QueryOwner, QueryInstance.QueryID);
+	const float MinThresholdValue = FloatValueMin.GetValue();
+	const float MaxThresholdValue = FloatValueMax.GetValue();
+
+	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	{
+		const AActor* ItemActor = GetItemActor(QueryInstance, It.GetIndex());
+		if (ItemActor == nullptr)
+		{
+			It.ForceItemState(EEnvItemStatus::Failed);
+			continue;
+		}
+
+		const TInlineComponentArray<UActorInteractableComponentBase*> Interactables(ItemActor);
+		if (Interactables.Num() == 0)
+		{
+			It.ForceItemState(EEnvItemStatus::Failed);
+			continue;
+		}
+
+		int32 HighestWeight = TNumericLimits<int32>::Lowest();
+		for (const UActorInteractableComponentBase* Itr : Interactables)
+		{
+			HighestWeight = FMath::Max(HighestWeight, Itr->GetInteractableWeight());
+		}
+
+		It.SetScore(TestPurpose, FilterType, static_cast<float>(HighestWeight), MinThresholdValue, MaxThresholdValue);
+	}
+}
+
+FText UEnvQueryTest_InteractableWeight::GetDescriptionTitle() const
+{
+	return LOCTEXT("DescriptionTitle", "Interactable Weight");
+}
+
+FText UEnvQueryTest_InteractableWeight::GetDescriptionDetails() const
+{
+	return DescribeFloatTestParams();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -2,20 +2,112 @@
 
 #include "ActorInteractionPlugin.h"
 
+#include "Blueprint/UserWidget.h"
+#include "Engine/DataTable.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CoreDelegates.h"
 #include "Styling/SlateStyleRegistry.h"
 
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
+
 #define LOCTEXT_NAMESPACE "FActorInteractionPluginModule"
 
 void FActorInteractionPluginModule::StartupModule()
 {
-	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	// Module is loaded before assets can be streamed, so Defaults are requested once Engine is initialized
+	if (GIsRunning)
+	{
+		RequestDefaultsLoad();
+	}
+	else
+	{
+		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FActorInteractionPluginModule::RequestDefaultsLoad);
+	}
 }
 
 void FActorInteractionPluginModule::ShutdownModule()
 {
-	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
-	// we call this function before unloading the module.
+	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+
+	if (DefaultsHandle.IsValid())
+	{
+		DefaultsHandle->CancelHandle();
+		DefaultsHandle.Reset();
+	}
+
+	CachedDefaultDataTable.Reset();
+	CachedDefaultWidgetClass.Reset();
+
+	DefaultsLoadedEvent.Clear();
+}
+
+void FActorInteractionPluginModule::RequestDefaultsLoad()
+{
+	if (DefaultsHandle.IsValid() || bDefaultsLoaded) return;
+
+	const UActorInteractionPluginSettings* Settings = GetDefault<UActorInteractionPluginSettings>();
+	if (Settings == nullptr)
+	{
+		AIntP_LOG(Error, TEXT("[RequestDefaultsLoad] Cannot load ActorInteractionPluginSettings! Defaults will not be preloaded."))
+		return;
+	}
+
+	TArray<FSoftObjectPath> DefaultsPaths;
+	if (!Settings->GetInteractableDefaultDataTable().IsNull())
+	{
+		DefaultsPaths.Add(Settings->GetInteractableDefaultDataTable().ToSoftObjectPath());
+	}
+	if (!Settings->GetInteractableDefaultWidgetClass().IsNull())
+	{
+		DefaultsPaths.Add(Settings->GetInteractableDefaultWidgetClass().ToSoftObjectPath());
+	}
+
+	if (DefaultsPaths.Num() == 0)
+	{
+		HandleDefaultsLoaded();
+		return;
+	}
+
+	DefaultsHandle = StreamableManager.RequestAsyncLoad(DefaultsPaths, FStreamableDelegate::CreateRaw(this, &FActorInteractionPluginModule::HandleDefaultsLoaded));
+}
+
+void FActorInteractionPluginModule::ReloadDefaults()
+{
+	if (DefaultsHandle.IsValid())
+	{
+		DefaultsHandle->CancelHandle();
+		DefaultsHandle.Reset();
+	}
+
+	CachedDefaultDataTable.Reset();
+	CachedDefaultWidgetClass.Reset();
+	bDefaultsLoaded = false;
+
+	RequestDefaultsLoad();
+}
+
+void FActorInteractionPluginModule::CacheDefaultDataTable(UDataTable* DataTable)
+{
+	CachedDefaultDataTable.Reset(DataTable);
+}
+
+void FActorInteractionPluginModule::CacheDefaultWidgetClass(const TSubclassOf<UUserWidget>& WidgetClass)
+{
+	CachedDefaultWidgetClass.Reset(WidgetClass.Get());
+}
+
+void FActorInteractionPluginModule::HandleDefaultsLoaded()
+{
+	// Loaded Defaults are held strongly, so they are never garbage collected
+	if (const UActorInteractionPluginSettings* Settings = GetDefault<UActorInteractionPluginSettings>())
+	{
+		CachedDefaultDataTable.Reset(Settings->GetInteractableDefaultDataTable().Get());
+		CachedDefaultWidgetClass.Reset(Settings->GetInteractableDefaultWidgetClass().Get());
+	}
+
+	bDefaultsLoaded = true;
+	DefaultsLoadedEvent.Broadcast();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -390,6 +390,8 @@ void UActorInteractableComponent::SetInteractionState(const EInteractableState N
 		default:
 			break;
 	}
+
+	PushInteractionProgressTiming();
 }
 
 void UActorInteractableComponent::InitializeInteractionComponent()
@@ -635,6 +637,23 @@ void UActorInteractableComponent::DeactivateInteractable()
 	SetInteractionState(EInteractableState::EIS_Disabled);
 }
 
+void UActorInteractableComponent::PushInteractionProgressTiming() const
+{
+	if (!InteractionWidget || !GetWorld()) return;
+
+	const float WorldTimeSeconds = GetWorld()->GetTimeSeconds();
+	
+	// Progress is frozen while not in use, same as when Widget calculated it every frame
+	if (!IsInUse() || InteractionTime <= 0.f)
+	{
+		InteractionWidget->SetInteractionProgressTiming(WorldTimeSeconds, InteractionWidget->GetInteractionProgress(), 0.f);
+		return;
+	}
+
+	const float InteractionFinishTime = GetLastInteractionTime() + InteractionTime;
+	InteractionWidget->SetInteractionProgressTiming(WorldTimeSeconds, (InteractionFinishTime - WorldTimeSeconds) / InteractionTime, -1.f / InteractionTime);
+}
+
 void UActorInteractableComponent::UpdateInteractableWidget() const
 {
 	if (InteractionWidget)
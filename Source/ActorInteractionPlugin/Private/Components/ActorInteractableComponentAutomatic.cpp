@@ -10,7 +10,6 @@
 UActorInteractableComponentAutomatic::UActorInteractableComponentAutomatic()
 {
 	InteractableName = LOCTEXT("ActorInteractableComponentAutomatic", "Auto");
-	InteractionKeysPerPlatform.Empty();
 
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
 	InteractionPeriod = 1.f;
@@ -25,6 +24,13 @@ void UActorInteractableComponentAutomatic::BeginPlay()
 	OnInteractionStopped.RemoveAll(this);
 }
 
+const TMap<FString, FInteractionKeySetup>& UActorInteractableComponentAutomatic::GetDefaultInteractionKeys() const
+{
+	// Automatic Interactables are not triggered by any Key
+	static const TMap<FString, FInteractionKeySetup> NoKeys;
+	return NoKeys;
+}
+
 void UActorInteractableComponentAutomatic::InteractableSelected(const TScriptInterface<IActorInteractableInterface>& Interactable)
 {
 	if(!GetWorld()) return;
@@ -32,7 +38,7 @@ void UActorInteractableComponentAutomatic::InteractableSelected(const TScriptInt
 	
 	if (Interactable == this)
 	{
-		if (GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction) == false)
+		if (IsInteracting() == false)
 		{
 			OnInteractionStarted.Broadcast(GetWorld()->GetTimeSeconds(), FKey(""), GetInteractor());
 		}
@@ -41,22 +47,22 @@ void UActorInteractableComponentAutomatic::InteractableSelected(const TScriptInt
 
 void UActorInteractableComponentAutomatic::InteractionStarted(const float& TimeStarted, const FKey& PressedKey, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
-	if (!GetWorld()) return;
+	UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem();
+	if (!TimingSubsystem) return;
 
-	if (CanInteract() && !GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction))
+	if (CanInteract() && !IsInteracting())
 	{
 		// Force Interaction Period to be at least 0.01s
 		const float TempInteractionPeriod = FMath::Max(0.01f, InteractionPeriod);
-		
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActorInteractableComponentAutomatic::OnInteractionCompletedCallback);
 
-		GetWorld()->GetTimerManager().SetTimer
+		ResetInteractionClock();
+		StartInteractionClock(CausingInteractor);
+
+		TimingSubsystem->SetTimer
 		(
 			Timer_Interaction,
-			Delegate,
-			TempInteractionPeriod,
-			false
+			FSimpleDelegate::CreateUObject(this, &UActorInteractableComponentAutomatic::OnInteractionCompletedCallback),
+			TempInteractionPeriod
 		);
 
 		Super::InteractionStarted(TimeStarted, PressedKey, CausingInteractor);
@@ -104,7 +110,7 @@ void UActorInteractableComponentAutomatic::OnInteractionCompletedCallback()
 		if (TriggerCooldown()) return;
 	}
 	
-	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), GetInteractor());
+	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), GetClockInteractor());
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -3,6 +3,7 @@
 #include "Components/ActorInteractableComponentBase.h"
 
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginStats.h"
 
 #if WITH_EDITOR
 #include "EditorHelper.h"
@@ -14,11 +15,55 @@
 #include "Components/ActorInteractableComponent.h"
 #include "Components/BillboardComponent.h"
 #include "Components/WidgetComponent.h"
+#include "Helpers/ActorInteractableDefinition.h"
 #include "Helpers/ActorInteractionFunctionLibrary.h"
+#include "Helpers/InteractionKeyTable.h"
 #include "Interfaces/ActorInteractorInterface.h"
+#include "Subsystems/ActorInteractableRegistrySubsystem.h"
+#include "Subsystems/ActorInteractionPromptSubsystem.h"
+
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/CustomVersion.h"
 
 #define LOCTEXT_NAMESPACE "InteractableComponentBase"
 
+DECLARE_CYCLE_STAT(TEXT("Interactable BeginPlay"), STAT_InteractableBeginPlay, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Interaction Progress"), STAT_InteractionProgress, STATGROUP_MounteaInteraction);
+
+namespace ActorInteractableCustomVersion
+{
+	enum Type
+	{
+		BeforeCustomVersionWasAdded = 0,
+		// Default Interaction Keys are shared by the class, overridden Keys are marked by bOverride_InteractionKeysPerPlatform
+		SharedDefaultInteractionKeys,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	const FGuid GUID(0x5A1C7E42, 0x9B3D4F18, 0xA6E2C0D7, 0x3F8B6419);
+}
+
+static FCustomVersionRegistration GRegisterActorInteractableCustomVersion(ActorInteractableCustomVersion::GUID, ActorInteractableCustomVersion::LatestVersion, TEXT("ActorInteractableVer"));
+
+static bool AreInteractionKeysEqual(const TMap<FString, FInteractionKeySetup>& A, const TMap<FString, FInteractionKeySetup>& B)
+{
+	if (A.Num() != B.Num()) return false;
+
+	for (const auto& Itr : A)
+	{
+		const FInteractionKeySetup* OtherKeySet = B.Find(Itr.Key);
+		if (OtherKeySet == nullptr || OtherKeySet->Keys != Itr.Value.Keys) return false;
+	}
+
+	return true;
+}
+
 UActorInteractableComponentBase::UActorInteractableComponentBase()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -48,14 +93,14 @@ UActorInteractableComponentBase::UActorInteractableComponentBase()
 	TimeToStart = 0.001f;
 	InteractableName = LOCTEXT("InteractableComponentBase", "Base");
 
-	const FInteractionKeySetup GamepadKeys = FKey("Gamepad_FaceButton_Bottom");
-	FInteractionKeySetup KeyboardKeys = GamepadKeys;
-	KeyboardKeys.Keys.Add("E");
-		
-	InteractionKeysPerPlatform.Add((TEXT("Windows")), KeyboardKeys);
-	InteractionKeysPerPlatform.Add((TEXT("Mac")), KeyboardKeys);
-	InteractionKeysPerPlatform.Add((TEXT("PS4")), GamepadKeys);
-	InteractionKeysPerPlatform.Add((TEXT("XboxOne")), GamepadKeys);
+	// Interaction Keys are left empty, class defaults are shared by all instances, see GetDefaultInteractionKeys
+	bOverride_InteractionPeriod = false;
+	bOverride_LifecycleMode = false;
+	bOverride_LifecycleCount = false;
+	bOverride_CooldownPeriod = false;
+	bOverride_InteractionKeysPerPlatform = false;
+	bOverride_IgnoredClasses = false;
+	bOverride_InteractableName = false;
 
 	Space = EWidgetSpace::Screen;
 	DrawSize = FIntPoint(64, 64);
@@ -65,14 +110,34 @@ UActorInteractableComponentBase::UActorInteractableComponentBase()
 	SetHiddenInGame(true);
 
 	CachedInteractionWeight = InteractionWeight;
+	LastInteractionTime = -1.f;
+
+	InteractionStartTime = -1.0;
+	InteractionPausedElapsed = -1.0;
+
+	MaxConcurrentInteractors = 1;
+	InteractorArbitration = EInteractorArbitration::EIA_ReplaceOldest;
+	PromptMode = EInteractablePromptMode::EIPM_WidgetComponent;
+	PendingWidgetUpdates = EInteractableWidgetDirty::None;
+	RunningPlatformKeySet = INDEX_NONE;
 
 #if WITH_EDITORONLY_DATA
 	bVisualizeComponent = true;
 #endif
 }
 
+void UActorInteractableComponentBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UActorInteractableComponentBase, InteractionStartTime);
+	DOREPLIFETIME(UActorInteractableComponentBase, InteractionPausedElapsed);
+}
+
 void UActorInteractableComponentBase::BeginPlay()
 {
+	SCOPE_CYCLE_COUNTER(STAT_InteractableBeginPlay);
+	
 	Super::BeginPlay();
 	
 	InteractionOwner = GetOwner();
@@ -91,33 +156,13 @@ void UActorInteractableComponentBase::BeginPlay()
 	OnInteractionStarted.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionStarted);
 	OnInteractionStopped.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionStopped);
 	OnInteractionCanceled.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionCanceled);
-	OnLifecycleCompleted.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionLifecycleCompleted);
-	OnCooldownCompleted.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionCooldownCompleted);
-	
-	// Attributes Events
-	OnInteractableDependencyChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableDependencyChangedEvent);
-	OnInteractableAutoSetupChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableAutoSetupChangedEvent);
-	OnInteractableWeightChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableWeightChangedEvent);
-	OnInteractableStateChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableStateChangedEvent);
-	OnInteractableOwnerChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableOwnerChangedEvent);
-	OnInteractableCollisionChannelChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableCollisionChannelChangedEvent);
-	OnLifecycleModeChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnLifecycleModeChangedEvent);
-	OnLifecycleCountChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnLifecycleCountChangedEvent);
-	OnCooldownPeriodChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnCooldownPeriodChangedEvent);
-	OnInteractorChanged.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractorChangedEvent);
+
+	// Attribute, Lifecycle, Highlight and Collision Events are not bound to self, their handlers are called directly once broadcast
 
 	// Ignored Classes Events
 	OnIgnoredInteractorClassAdded.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnIgnoredClassAdded);
 	OnIgnoredInteractorClassRemoved.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnIgnoredClassRemoved);
 
-	// Highlight Events
-	OnHighlightableComponentAdded.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnHighlightableComponentAddedEvent);
-	OnHighlightableComponentRemoved.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnHighlightableComponentRemovedEvent);
-	
-	// Collision Events
-	OnCollisionComponentAdded.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnCollisionComponentAddedEvent);
-	OnCollisionComponentRemoved.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnCollisionComponentRemovedEvent);
-
 	// Widget
 	OnWidgetUpdated.AddUniqueDynamic(this, &UActorInteractableComponentBase::OnWidgetUpdatedEvent);
 
@@ -125,12 +170,32 @@ void UActorInteractableComponentBase::BeginPlay()
 	InteractableDependencyStarted.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractableDependencyStartedCallback);
 	InteractableDependencyStopped.AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractableDependencyStoppedCallback);
 	
+	ApplyInteractableDefinition();
+	RefreshRunningPlatformKeys();
+	
 	RemainingLifecycleCount = LifecycleCount;
 	
 	SetState(DefaultInteractableState);
 
 	AutoSetup();
 
+	// Widget Component only ticks to render its own Widget, which pooled and batched Interactables do not have
+	if (PromptMode != EInteractablePromptMode::EIPM_WidgetComponent)
+	{
+		SetComponentTickEnabled(false);
+	}
+
+	if (UActorInteractableRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UActorInteractableRegistrySubsystem>() : nullptr)
+	{
+		// Collision Components loaded from save, serialized or added in Construction Script never went through AddCollisionComponent
+		for (const UPrimitiveComponent* Itr : CollisionComponents)
+		{
+			Registry->RegisterCollisionComponent(Itr, this);
+		}
+		
+		Registry->RegisterSpatialInteractable(this);
+	}
+
 #if WITH_EDITOR
 	
 	DrawDebug();
@@ -138,8 +203,43 @@ void UActorInteractableComponentBase::BeginPlay()
 #endif
 }
 
+void UActorInteractableComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (UActorInteractableRegistrySubsystem* Registry = World->GetSubsystem<UActorInteractableRegistrySubsystem>())
+		{
+			Registry->UnregisterInteractable(this);
+			Registry->UnregisterSpatialInteractable(this);
+		}
+	}
+
+	if (UActorInteractionPromptSubsystem* PromptSubsystem = ActivePromptSubsystem.Get())
+	{
+		PromptSubsystem->HidePrompt(this);
+	}
+	ActivePromptSubsystem.Reset();
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+void UActorInteractableComponentBase::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (Mobility != EComponentMobility::Movable || !HasBegunPlay()) return;
+
+	if (UActorInteractableRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UActorInteractableRegistrySubsystem>() : nullptr)
+	{
+		Registry->UpdateSpatialInteractable(this);
+	}
+}
+
 void UActorInteractableComponentBase::InitWidget()
 {
+	// Pooled and batched Interactables never create their own Widget
+	if (PromptMode != EInteractablePromptMode::EIPM_WidgetComponent) return;
+	
 	Super::InitWidget();
 
 	UpdateInteractionWidget();
@@ -172,6 +272,26 @@ void UActorInteractableComponentBase::OnRegister()
 	Super::OnRegister();
 }
 
+void UActorInteractableComponentBase::Serialize(FArchive& Ar)
+{
+	Ar.UsingCustomVersion(ActorInteractableCustomVersion::GUID);
+
+	// Older Interactables constructed default Keys themselves and only saved Keys which differed from their archetype
+	const bool bUpgradeInteractionKeys = Ar.IsLoading() && Ar.CustomVer(ActorInteractableCustomVersion::GUID) < ActorInteractableCustomVersion::SharedDefaultInteractionKeys;
+	if (bUpgradeInteractionKeys && !bOverride_InteractionKeysPerPlatform)
+	{
+		InteractionKeysPerPlatform = GetDefaultInteractionKeys();
+	}
+
+	Super::Serialize(Ar);
+
+	if (!bUpgradeInteractionKeys) return;
+
+	// Keys equal to class defaults are shared again, anything else, including cleared Keys, stays overridden
+	bOverride_InteractionKeysPerPlatform = !AreInteractionKeysEqual(InteractionKeysPerPlatform, GetDefaultInteractionKeys());
+	if (!bOverride_InteractionKeysPerPlatform) InteractionKeysPerPlatform.Empty();
+}
+
 bool UActorInteractableComponentBase::DoesHaveInteractor() const
 {
 	return Interactor.GetObject() != nullptr;
@@ -297,21 +417,25 @@ void UActorInteractableComponentBase::PauseInteraction(const float ExpirationTim
 	SetState(EInteractableStateV2::EIS_Paused);
 	const bool bIsUnlimited = FMath::IsWithinInclusive(InteractionProgressExpiration, -1.f, 0.f) || FMath::IsNearlyZero(InteractionProgressExpiration, 0.001f);
 	
+	UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem();
+	if (!TimingSubsystem) return;
+	
+	// Completion Timer is armed again with remaining time once interaction resumes
+	PauseInteractionClock();
+	TimingSubsystem->ClearTimer(Timer_Interaction);
+	
 	if (bIsUnlimited)
 	{
-		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
 		return;
 	}
 	
 	if (!bIsUnlimited)
 	{
-		FTimerDelegate TimerDelegate_ProgressExpiration;
-		TimerDelegate_ProgressExpiration.BindUFunction(this, "OnInteractionProgressExpired", ExpirationTime, UsedKey, CausingInteractor);
+		const FSimpleDelegate TimerDelegate_ProgressExpiration = FSimpleDelegate::CreateUObject(this, &UActorInteractableComponentBase::OnInteractionProgressExpired, ExpirationTime, UsedKey, CausingInteractor);
 
 		const float ClampedExpiration = FMath::Max(InteractionProgressExpiration, 0.01f);
 		
-		GetWorld()->GetTimerManager().SetTimer(Timer_ProgressExpiration, TimerDelegate_ProgressExpiration, ClampedExpiration, false);
-		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
+		TimingSubsystem->SetTimer(Timer_ProgressExpiration, TimerDelegate_ProgressExpiration, ClampedExpiration);
 	}
 	else
 	{
@@ -366,13 +490,7 @@ bool UActorInteractableComponentBase::CanBeTriggered() const
 
 bool UActorInteractableComponentBase::IsInteracting() const
 {
-	if (GetWorld())
-	{
-		return GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction);
-	}
-
-	AIntP_LOG(Error, TEXT("[IsInteracting] Cannot find World!"))
-	return false;
+	return InteractionStartTime >= 0.0 && !IsInteractionClockPaused();
 }
 
 EInteractableStateV2 UActorInteractableComponentBase::GetDefaultState() const
@@ -399,8 +517,9 @@ EInteractableStateV2 UActorInteractableComponentBase::GetState() const
 void UActorInteractableComponentBase::CleanupComponent()
 {
 	StopHighlight();
-	OnInteractableStateChanged.Broadcast(InteractableState);
-	if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+	BroadcastInteractableStateChanged(InteractableState);
+	if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem()) TimingSubsystem->ClearAllTimersForObject(this);
+	ResetInteractionClock();
 	OnInteractorLost.Broadcast(Interactor);
 
 	RemoveHighlightableComponents(HighlightableComponents);
@@ -409,6 +528,8 @@ void UActorInteractableComponentBase::CleanupComponent()
 
 void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewState)
 {
+	const EInteractableStateV2 PreviousState = InteractableState;
+	
 	switch (NewState)
 	{
 		case EInteractableStateV2::EIS_Active:
@@ -417,7 +538,7 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 				case EInteractableStateV2::EIS_Paused:
 				case EInteractableStateV2::EIS_Awake:
 					InteractableState = NewState;
-					OnInteractableStateChanged.Broadcast(InteractableState);
+					BroadcastInteractableStateChanged(InteractableState);
 					break;
 				case EInteractableStateV2::EIS_Active:
 					break;
@@ -441,7 +562,7 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 				case EInteractableStateV2::EIS_Paused:
 					{
 						InteractableState = NewState;
-						OnInteractableStateChanged.Broadcast(InteractableState);
+						BroadcastInteractableStateChanged(InteractableState);
 
 						for (const auto& Itr : CollisionComponents)
 						{
@@ -469,8 +590,9 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 
 						// Replacing Cleanup
 						StopHighlight();
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+						BroadcastInteractableStateChanged(InteractableState);
+						if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem()) TimingSubsystem->ClearAllTimersForObject(this);
+						ResetInteractionClock();
 						OnInteractorLost.Broadcast(Interactor);
 						
 						for (const auto& Itr : CollisionComponents)
@@ -492,7 +614,7 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 				case EInteractableStateV2::EIS_Active:
 					InteractableState = NewState;
 					StopHighlight();
-					OnInteractableStateChanged.Broadcast(InteractableState);
+					BroadcastInteractableStateChanged(InteractableState);
 					break;
 				case EInteractableStateV2::EIS_Suppressed:
 				case EInteractableStateV2::EIS_Disabled:
@@ -501,8 +623,9 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 
 						// Replacing Cleanup
 						StopHighlight();
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+						BroadcastInteractableStateChanged(InteractableState);
+						if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem()) TimingSubsystem->ClearAllTimersForObject(this);
+						ResetInteractionClock();
 						OnInteractorLost.Broadcast(Interactor);
 						
 						for (const auto& Itr : CollisionComponents)
@@ -554,8 +677,9 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 
 						// Replacing Cleanup
 						StopHighlight();
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+						BroadcastInteractableStateChanged(InteractableState);
+						if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem()) TimingSubsystem->ClearAllTimersForObject(this);
+						ResetInteractionClock();
 						OnInteractorLost.Broadcast(Interactor);
 						
 						for (const auto& Itr : CollisionComponents)
@@ -580,14 +704,14 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 					OnInteractionCanceled.Broadcast();
 					InteractableState = NewState;
 					StopHighlight();
-					OnInteractableStateChanged.Broadcast(InteractableState);
+					BroadcastInteractableStateChanged(InteractableState);
 					break;
 				case EInteractableStateV2::EIS_Cooldown:
 					OnInteractionCanceled.Broadcast();
 					InteractableState = NewState;
 					StopHighlight();
-					OnInteractableStateChanged.Broadcast(InteractableState);
-					GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
+					BroadcastInteractableStateChanged(InteractableState);
+					if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem()) TimingSubsystem->ClearTimer(Timer_Cooldown);
 					break;
 				case EInteractableStateV2::EIS_Completed:
 				case EInteractableStateV2::EIS_Suppressed:
@@ -601,7 +725,7 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 				case EInteractableStateV2::EIS_Active:
 					{
 						InteractableState = NewState;
-						OnInteractableStateChanged.Broadcast(InteractableState);
+						BroadcastInteractableStateChanged(InteractableState);
 						break;
 					}
 				case EInteractableStateV2::EIS_Paused:
@@ -621,6 +745,11 @@ void UActorInteractableComponentBase::SetState(const EInteractableStateV2 NewSta
 			break;
 	}
 	
+	if (InteractableState != PreviousState)
+	{
+		MarkWidgetDirty(EInteractableWidgetDirty::State | EInteractableWidgetDirty::Progress);
+	}
+	
 	ProcessDependencies();
 }
 
@@ -645,22 +774,23 @@ void UActorInteractableComponentBase::StopHighlight()
 }
 
 TArray<TSoftClassPtr<UObject>> UActorInteractableComponentBase::GetIgnoredClasses() const
-{ return IgnoredClasses; }
+{ return GetResolvedIgnoredClasses(); }
 
 void UActorInteractableComponentBase::SetIgnoredClasses(const TArray<TSoftClassPtr<UObject>> NewIgnoredClasses)
 {
 	IgnoredClasses.Empty();
 
 	IgnoredClasses = NewIgnoredClasses;
+	bOverride_IgnoredClasses = true;
 }
 
 void UActorInteractableComponentBase::AddIgnoredClass(TSoftClassPtr<UObject> AddIgnoredClass)
 {
 	if (AddIgnoredClass == nullptr) return;
 
-	if (IgnoredClasses.Contains(AddIgnoredClass)) return;
+	if (GetResolvedIgnoredClasses().Contains(AddIgnoredClass)) return;
 
-	IgnoredClasses.Add(AddIgnoredClass);
+	GetMutableIgnoredClasses().Add(AddIgnoredClass);
 
 	OnIgnoredInteractorClassAdded.Broadcast(AddIgnoredClass);
 }
@@ -677,9 +807,9 @@ void UActorInteractableComponentBase::RemoveIgnoredClass(TSoftClassPtr<UObject>
 {
 	if (RemoveIgnoredClass == nullptr) return;
 
-	if (!IgnoredClasses.Contains(RemoveIgnoredClass)) return;
+	if (!GetResolvedIgnoredClasses().Contains(RemoveIgnoredClass)) return;
 
-	IgnoredClasses.Remove(RemoveIgnoredClass);
+	GetMutableIgnoredClasses().Remove(RemoveIgnoredClass);
 
 	OnIgnoredInteractorClassRemoved.Broadcast(RemoveIgnoredClass);
 }
@@ -697,6 +827,7 @@ void UActorInteractableComponentBase::AddInteractionDependency(const TScriptInte
 	if (InteractionDependency.GetObject() == nullptr) return;
 	if (InteractionDependencies.Contains(InteractionDependency)) return;
 
+	if (HasBegunPlay()) OnInteractableDependencyChangedEvent(InteractionDependency);
 	OnInteractableDependencyChanged.Broadcast(InteractionDependency);
 	
 	InteractionDependencies.Add(InteractionDependency);
@@ -709,6 +840,7 @@ void UActorInteractableComponentBase::RemoveInteractionDependency(const TScriptI
 	if (InteractionDependency.GetObject() == nullptr) return;
 	if (!InteractionDependencies.Contains(InteractionDependency)) return;
 
+	if (HasBegunPlay()) OnInteractableDependencyChangedEvent(InteractionDependency);
 	OnInteractableDependencyChanged.Broadcast(InteractionDependency);
 
 	InteractionDependencies.Remove(InteractionDependency);
@@ -791,6 +923,45 @@ void UActorInteractableComponentBase::SetInteractor(const TScriptInterface<IActo
 	const TScriptInterface<IActorInteractorInterface> OldInteractor = Interactor;
 
 	Interactor = NewInteractor;
+
+	// Keep slot 0 for Interactor
+	if (NewInteractor.GetInterface() != nullptr)
+	{
+		const int32 SlotIndex = FindInteractorSlot(NewInteractor);
+		if (SlotIndex == INDEX_NONE)
+		{
+			if (MaxConcurrentInteractors <= 1)
+			{
+				ClearInteractorSlots();
+			}
+			AddInteractorSlot(NewInteractor, 0);
+		}
+		else if (SlotIndex != 0)
+		{
+			const float StartTime = SlotStartTimes[SlotIndex];
+			const FKey Key = SlotKeys[SlotIndex];
+			const float Progress = SlotProgress[SlotIndex];
+			
+			RemoveInteractorSlot(SlotIndex);
+			AddInteractorSlot(NewInteractor, 0);
+			
+			SlotStartTimes[0] = StartTime;
+			SlotKeys[0] = Key;
+			SlotProgress[0] = Progress;
+		}
+	}
+	else
+	{
+		const int32 SlotIndex = FindInteractorSlot(OldInteractor);
+		if (SlotIndex != INDEX_NONE)
+		{
+			RemoveInteractorSlot(SlotIndex);
+		}
+		if (MaxConcurrentInteractors <= 1)
+		{
+			ClearInteractorSlots();
+		}
+	}
 	
 	if (NewInteractor.GetInterface() != nullptr)
 	{
@@ -808,16 +979,61 @@ void UActorInteractableComponentBase::SetInteractor(const TScriptInterface<IActo
 	}
 
 	//Interactor = NewInteractor;
-	OnInteractorChanged.Broadcast(Interactor);
+	BroadcastInteractorChanged(Interactor);
+}
+
+float UActorInteractableComponentBase::GetInteractionProgressForInteractor(const TScriptInterface<IActorInteractorInterface>& RequestedInteractor) const
+{
+	const int32 SlotIndex = FindInteractorSlot(RequestedInteractor);
+	if (SlotIndex == INDEX_NONE) return -1.f;
+
+	float Progress = SlotProgress[SlotIndex];
+	if (SlotStartTimes[SlotIndex] >= 0.f && GetWorld())
+	{
+		Progress += (GetWorld()->GetTimeSeconds() - SlotStartTimes[SlotIndex]) / FMath::Max(InteractionPeriod, 0.01f);
+	}
+	
+	return FMath::Clamp(Progress, 0.f, 1.f);
+}
+
+bool UActorInteractableComponentBase::IsAnyInteractorInteracting() const
+{
+	for (const float Itr : SlotStartTimes)
+	{
+		if (Itr >= 0.f) return true;
+	}
+
+	return false;
+}
+
+void UActorInteractableComponentBase::ReleaseInteractorSlot(const TScriptInterface<IActorInteractorInterface>& ReleasingInteractor)
+{
+	if (SlotInteractors.Num() <= 1) return;
+	if (FindInteractorSlot(ReleasingInteractor) == INDEX_NONE) return;
+
+	InteractorLost(ReleasingInteractor);
+}
+
+void UActorInteractableComponentBase::SetMaxConcurrentInteractors(const int32 NewMaxConcurrentInteractors)
+{
+	MaxConcurrentInteractors = FMath::Max(1, NewMaxConcurrentInteractors);
+
+	while (SlotInteractors.Num() > MaxConcurrentInteractors)
+	{
+		EvictInteractorSlot(SlotInteractors.Num() - 1);
+	}
 }
 
 float UActorInteractableComponentBase::GetInteractionProgress() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_InteractionProgress);
+	
 	if (!GetWorld()) return -1;
 
-	if (Timer_Interaction.IsValid())
+	// Completion fires on next Timing Wheel slot, so elapsed time might briefly exceed Interaction Period
+	if (InteractionStartTime >= 0.0)
 	{
-		return GetWorld()->GetTimerManager().GetTimerElapsed(Timer_Interaction) / InteractionPeriod;
+		return FMath::Clamp(GetInteractionElapsed() * GetInteractionPeriodInverse(), 0.f, 1.f);
 	}
 	return 0.f;
 }
@@ -838,6 +1054,7 @@ void UActorInteractableComponentBase::SetInteractionPeriod(const float NewPeriod
 	}
 
 	InteractionPeriod = FMath::Max(-1.f, TempPeriod);
+	MarkWidgetDirty(EInteractableWidgetDirty::Progress);
 }
 
 int32 UActorInteractableComponentBase::GetInteractableWeight() const
@@ -847,6 +1064,7 @@ void UActorInteractableComponentBase::SetInteractableWeight(const int32 NewWeigh
 {
 	InteractionWeight = NewWeight;
 
+	if (HasBegunPlay()) OnInteractableWeightChangedEvent(InteractionWeight);
 	OnInteractableWeightChanged.Broadcast(InteractionWeight);
 }
 
@@ -858,6 +1076,7 @@ void UActorInteractableComponentBase::SetInteractableOwner(AActor* NewOwner)
 	if (NewOwner == nullptr) return;
 	InteractionOwner = NewOwner;
 	
+	if (HasBegunPlay()) OnInteractableOwnerChangedEvent(InteractionOwner);
 	OnInteractableOwnerChanged.Broadcast(InteractionOwner);
 }
 
@@ -868,6 +1087,7 @@ void UActorInteractableComponentBase::SetCollisionChannel(const ECollisionChanne
 {
 	CollisionChannel = NewChannel;
 
+	if (HasBegunPlay()) OnInteractableCollisionChannelChangedEvent(CollisionChannel);
 	OnInteractableCollisionChannelChanged.Broadcast(CollisionChannel);
 }
 
@@ -881,6 +1101,7 @@ void UActorInteractableComponentBase::SetLifecycleMode(const EInteractableLifecy
 {
 	LifecycleMode = NewMode;
 
+	if (HasBegunPlay()) OnLifecycleModeChangedEvent(LifecycleMode);
 	OnLifecycleModeChanged.Broadcast(LifecycleMode);
 }
 
@@ -895,16 +1116,19 @@ void UActorInteractableComponentBase::SetLifecycleCount(const int32 NewLifecycle
 			if (NewLifecycleCount < -1)
 			{
 				LifecycleCount = -1;
+				if (HasBegunPlay()) OnLifecycleCountChangedEvent(LifecycleCount);
 				OnLifecycleCountChanged.Broadcast(LifecycleCount);
 			}
 			else if (NewLifecycleCount < 2)
 			{
 				LifecycleCount = 2;
+				if (HasBegunPlay()) OnLifecycleCountChangedEvent(LifecycleCount);
 				OnLifecycleCountChanged.Broadcast(LifecycleCount);
 			}
 			else if (NewLifecycleCount > 2)
 			{
 				LifecycleCount = NewLifecycleCount;
+				if (HasBegunPlay()) OnLifecycleCountChangedEvent(LifecycleCount);
 				OnLifecycleCountChanged.Broadcast(LifecycleCount);
 			}
 			break;
@@ -926,6 +1150,7 @@ void UActorInteractableComponentBase::SetCooldownPeriod(const float NewCooldownP
 	{
 		case EInteractableLifecycle::EIL_Cycled:
 			LifecycleCount = FMath::Max(0.1f, NewCooldownPeriod);
+			if (HasBegunPlay()) OnLifecycleCountChangedEvent(LifecycleCount);
 			OnLifecycleCountChanged.Broadcast(LifecycleCount);
 			break;
 		case EInteractableLifecycle::EIL_OnlyOnce:
@@ -936,7 +1161,13 @@ void UActorInteractableComponentBase::SetCooldownPeriod(const float NewCooldownP
 
 FKey UActorInteractableComponentBase::GetInteractionKeyForPlatform(const FString& RequestedPlatform) const
 {
-	if(const FInteractionKeySetup* KeySet = InteractionKeysPerPlatform.Find(RequestedPlatform))
+	if (FInteractionKeyTable::Get().IsRunningPlatform(RequestedPlatform))
+	{
+		const TArray<FKey>& Keys = GetRunningPlatformKeys();
+		return Keys.Num() > 0 ? Keys[0] : FKey();
+	}
+	
+	if(const FInteractionKeySetup* KeySet = GetResolvedInteractionKeys().Find(RequestedPlatform))
 	{
 		if (KeySet->Keys.Num() == 0) return FKey();
 
@@ -948,7 +1179,12 @@ FKey UActorInteractableComponentBase::GetInteractionKeyForPlatform(const FString
 
 TArray<FKey> UActorInteractableComponentBase::GetInteractionKeysForPlatform(const FString& RequestedPlatform) const
 {
-	if(const FInteractionKeySetup* KeySet = InteractionKeysPerPlatform.Find(RequestedPlatform))
+	if (FInteractionKeyTable::Get().IsRunningPlatform(RequestedPlatform))
+	{
+		return GetRunningPlatformKeys();
+	}
+	
+	if(const FInteractionKeySetup* KeySet = GetResolvedInteractionKeys().Find(RequestedPlatform))
 	{
 		if (KeySet->Keys.Num() == 0) return TArray<FKey>();
 
@@ -960,20 +1196,26 @@ TArray<FKey> UActorInteractableComponentBase::GetInteractionKeysForPlatform(cons
 
 void UActorInteractableComponentBase::SetInteractionKey(const FString& Platform, const FKey NewInteractorKey)
 {
-	if (const auto KeySet = InteractionKeysPerPlatform.Find(Platform))
+	if (const auto KeySet = GetResolvedInteractionKeys().Find(Platform))
 	{
 		if (KeySet->Keys.Contains(NewInteractorKey)) return;
 
-		KeySet->Keys.Add(NewInteractorKey);
+		GetMutableInteractionKeys().FindChecked(Platform).Keys.Add(NewInteractorKey);
+		MarkWidgetDirty(EInteractableWidgetDirty::Key);
 	}
 }
 
 TMap<FString, FInteractionKeySetup> UActorInteractableComponentBase::GetInteractionKeys() const
-{	return InteractionKeysPerPlatform;}
+{	return GetResolvedInteractionKeys();}
 
 bool UActorInteractableComponentBase::FindKey(const FKey& RequestedKey, const FString& Platform) const
 {
-	if (const auto KeySet = InteractionKeysPerPlatform.Find(Platform))
+	if (FInteractionKeyTable::Get().IsRunningPlatform(Platform))
+	{
+		return HasRunningPlatformKey(RequestedKey);
+	}
+	
+	if (const auto KeySet = GetResolvedInteractionKeys().Find(Platform))
 	{
 		return KeySet->Keys.Contains(RequestedKey);
 	}
@@ -981,15 +1223,46 @@ bool UActorInteractableComponentBase::FindKey(const FKey& RequestedKey, const FS
 	return false;
 }
 
+const TArray<FKey>& UActorInteractableComponentBase::GetRunningPlatformKeys() const
+{
+	FInteractionKeyTable& KeyTable = FInteractionKeyTable::Get();
+	if (RunningPlatformKeySet == INDEX_NONE && HasBegunPlay() && IsInGameThread())
+	{
+		RunningPlatformKeySet = KeyTable.FindOrAddKeySet(GetResolvedInteractionKeys());
+	}
+	if (RunningPlatformKeySet != INDEX_NONE) return KeyTable.GetKeys(RunningPlatformKeySet);
+
+	if (const FInteractionKeySetup* KeySet = GetResolvedInteractionKeys().Find(KeyTable.GetRunningPlatformName()))
+	{
+		return KeySet->Keys;
+	}
+
+	return KeyTable.GetKeys(0);
+}
+
+bool UActorInteractableComponentBase::HasRunningPlatformKey(const FKey& RequestedKey) const
+{
+	return GetRunningPlatformKeys().Contains(RequestedKey);
+}
+
 void UActorInteractableComponentBase::AddCollisionComponent(UPrimitiveComponent* CollisionComp)
 {
 	if (CollisionComp == nullptr) return;
 	if (CollisionComponents.Contains(CollisionComp)) return;
 	
 	CollisionComponents.Add(CollisionComp);
+
+	if (const UWorld* World = GetWorld())
+	{
+		if (UActorInteractableRegistrySubsystem* Registry = World->GetSubsystem<UActorInteractableRegistrySubsystem>())
+		{
+			Registry->RegisterCollisionComponent(CollisionComp, this);
+		}
+	}
 	
 	BindCollisionShape(CollisionComp);
 	
+	if (HasBegunPlay()) OnCollisionComponentAddedEvent(CollisionComp);
 	OnCollisionComponentAdded.Broadcast(CollisionComp);
 }
 
@@ -1008,8 +1281,17 @@ void UActorInteractableComponentBase::RemoveCollisionComponent(UPrimitiveCompone
 	
 	CollisionComponents.Remove(CollisionComp);
 
+	if (const UWorld* World = GetWorld())
+	{
+		if (UActorInteractableRegistrySubsystem* Registry = World->GetSubsystem<UActorInteractableRegistrySubsystem>())
+		{
+			Registry->UnregisterCollisionComponent(CollisionComp, this);
+		}
+	}
+
 	UnbindCollisionShape(CollisionComp);
 	
+	if (HasBegunPlay()) OnCollisionComponentRemovedEvent(CollisionComp);
 	OnCollisionComponentRemoved.Broadcast(CollisionComp);
 }
 
@@ -1033,6 +1315,7 @@ void UActorInteractableComponentBase::AddHighlightableComponent(UMeshComponent*
 
 	BindHighlightableMesh(MeshComponent);
 
+	if (HasBegunPlay()) OnHighlightableComponentAddedEvent(MeshComponent);
 	OnHighlightableComponentAdded.Broadcast(MeshComponent);
 }
 
@@ -1053,6 +1336,7 @@ void UActorInteractableComponentBase::RemoveHighlightableComponent(UMeshComponen
 
 	UnbindHighlightableMesh(MeshComponent);
 
+	if (HasBegunPlay()) OnHighlightableComponentRemovedEvent(MeshComponent);
 	OnHighlightableComponentRemoved.Broadcast(MeshComponent);
 }
 
@@ -1149,12 +1433,18 @@ void UActorInteractableComponentBase::SetInteractableData(FDataTableRowHandle Ne
 { InteractableData = NewData; }
 
 FText UActorInteractableComponentBase::GetInteractableName() const
-{ return InteractableName; }
+{
+	if (InteractableDefinition && !bOverride_InteractableName) return InteractableDefinition->GetInteractableName();
+	
+	return InteractableName;
+}
 
 void UActorInteractableComponentBase::SetInteractableName(const FText& NewName)
 {
 	if (NewName.IsEmpty()) return;
 	InteractableName = NewName;
+	bOverride_InteractableName = true;
+	MarkWidgetDirty(EInteractableWidgetDirty::Name);
 }
 
 ETimingComparison UActorInteractableComponentBase::GetComparisonMethod() const
@@ -1183,10 +1473,21 @@ void UActorInteractableComponentBase::InteractorFound(const TScriptInterface<IAc
 {
 	if (CanBeTriggered())
 	{
-		ToggleWidgetVisibility(true);
+		// Additional Interactors hold their own slots and do not replace Interactor
+		if (MaxConcurrentInteractors > 1 && Interactor.GetInterface() != nullptr && Interactor != FoundInteractor)
+		{
+			if (AcquireInteractorSlot(FoundInteractor))
+			{
+				Execute_OnInteractorFoundEvent(this, FoundInteractor);
+			}
+			return;
+		}
 		
+		// Interactor is set first, so Prompt can be shown for its Local Player
 		SetInteractor(FoundInteractor);
 		
+		ToggleWidgetVisibility(true);
+		
 		Execute_OnInteractorFoundEvent(this, FoundInteractor);
 	}
 }
@@ -1194,11 +1495,43 @@ void UActorInteractableComponentBase::InteractorFound(const TScriptInterface<IAc
 void UActorInteractableComponentBase::InteractorLost(const TScriptInterface<IActorInteractorInterface>& LostInteractor)
 {
 	if (LostInteractor.GetInterface() == nullptr) return;
+
+	// While other Interactors hold slots, only slot of Lost Interactor is released
+	if (SlotInteractors.Num() > 1)
+	{
+		const int32 SlotIndex = FindInteractorSlot(LostInteractor);
+		if (SlotIndex == INDEX_NONE) return;
+
+		const bool bWasInteracting = SlotStartTimes[SlotIndex] >= 0.f;
+
+		LostInteractor->GetOnInteractableSelectedHandle().RemoveDynamic(this, &UActorInteractableComponentBase::InteractableSelected);
+		LostInteractor->GetOnInteractableLostHandle().RemoveDynamic(this, &UActorInteractableComponentBase::InteractableLost);
+		
+		RemoveInteractorSlot(SlotIndex);
+		HandOverInteractionClock(LostInteractor);
+		if (SlotIndex == 0)
+		{
+			Interactor = SlotInteractors[0];
+			BroadcastInteractorChanged(Interactor);
+		}
+		
+		Execute_OnInteractorLostEvent(this, LostInteractor);
+
+		if (bWasInteracting && !IsAnyInteractorInteracting())
+		{
+			OnInteractionCanceled.Broadcast();
+		}
+		return;
+	}
 	
 	if (Interactor == LostInteractor)
 	{
-		GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
-		GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+		if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
+		{
+			TimingSubsystem->ClearTimer(Timer_Interaction);
+			TimingSubsystem->ClearTimer(Timer_ProgressExpiration);
+		}
+		ResetInteractionClock();
 		
 		ToggleWidgetVisibility(false);
 
@@ -1240,6 +1573,10 @@ void UActorInteractableComponentBase::InteractorLost(const TScriptInterface<IAct
 
 void UActorInteractableComponentBase::InteractionCompleted(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
+	LastInteractionTime = GetWorld() ? GetWorld()->GetTimeSeconds() : TimeCompleted;
+	ResetInteractorSlotsProgress();
+	ResetInteractionClock();
+	
 	ToggleWidgetVisibility(false);
 	
 	if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
@@ -1264,7 +1601,14 @@ void UActorInteractableComponentBase::InteractionStarted(const float& TimeStarte
 {
 	if (CanInteract())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+		const int32 SlotIndex = FindInteractorSlot(CausingInteractor);
+		if (SlotIndex != INDEX_NONE)
+		{
+			SlotStartTimes[SlotIndex] = GetWorld()->GetTimeSeconds();
+			SlotKeys[SlotIndex] = PressedKey;
+		}
+		
+		if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem()) TimingSubsystem->ClearTimer(Timer_ProgressExpiration);
 		
 		SetState(EInteractableStateV2::EIS_Active);
 		Execute_OnInteractionStartedEvent(this, TimeStarted, PressedKey, CausingInteractor);
@@ -1275,17 +1619,34 @@ void UActorInteractableComponentBase::InteractionStopped(const float& TimeStarte
 {
 	if (!GetWorld()) return;
 
+	const int32 SlotIndex = FindInteractorSlot(CausingInteractor);
+	if (SlotIndex != INDEX_NONE && SlotStartTimes[SlotIndex] >= 0.f)
+	{
+		SlotProgress[SlotIndex] = GetInteractionProgressForInteractor(CausingInteractor);
+		SlotStartTimes[SlotIndex] = -1.f;
+	}
+	HandOverInteractionClock(CausingInteractor);
+
+	// Interaction continues while any other Interactor is interacting
+	if (IsAnyInteractorInteracting()) return;
+
 	PauseInteraction(TimeStarted, PressedKey, CausingInteractor);
 }
 
 void UActorInteractableComponentBase::InteractionCanceled()
 {
+	ResetInteractorSlotsProgress();
+	
 	if (CanInteract())
 	{
 		ToggleWidgetVisibility(false);
 		
-		GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
-		GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+		if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
+		{
+			TimingSubsystem->ClearTimer(Timer_Interaction);
+			TimingSubsystem->ClearTimer(Timer_ProgressExpiration);
+		}
+		ResetInteractionClock();
 		
 		switch (GetState())
 		{
@@ -1361,7 +1722,7 @@ void UActorInteractableComponentBase::OnInteractableBeginOverlap(UPrimitiveCompo
 	for (const auto& Itr : InteractorComponents)
 	{
 		TScriptInterface<IActorInteractorInterface> FoundInteractor;
-		if (IgnoredClasses.Contains(Itr->StaticClass())) continue;
+		if (GetResolvedIgnoredClasses().Contains(Itr->StaticClass())) continue;
 		
 		FoundInteractor = Itr;
 		FoundInteractor.SetObject(Itr);
@@ -1400,7 +1761,7 @@ void UActorInteractableComponentBase::OnInteractableStopOverlap(UPrimitiveCompon
 	for (const auto& Itr : InteractorComponents)
 	{
 		TScriptInterface<IActorInteractorInterface> LostInteractor;
-		if (IgnoredClasses.Contains(Itr->StaticClass())) continue;
+		if (GetResolvedIgnoredClasses().Contains(Itr->StaticClass())) continue;
 		
 		LostInteractor = Itr;
 		LostInteractor.SetObject(Itr);
@@ -1408,12 +1769,12 @@ void UActorInteractableComponentBase::OnInteractableStopOverlap(UPrimitiveCompon
 
 		if (LostInteractor->CanInteract())
 		{
-			if (LostInteractor == GetInteractor())
+			if (FindInteractorSlot(LostInteractor) != INDEX_NONE)
 			{
-				GetInteractor()->GetOnInteractableLostHandle().RemoveDynamic(this, &UActorInteractableComponentBase::InteractableLost);
-				GetInteractor()->GetOnInteractableLostHandle().Broadcast(this);
+				LostInteractor->GetOnInteractableLostHandle().RemoveDynamic(this, &UActorInteractableComponentBase::InteractableLost);
+				LostInteractor->GetOnInteractableLostHandle().Broadcast(this);
 				
-				OnInteractorLost.Broadcast(GetInteractor());
+				OnInteractorLost.Broadcast(LostInteractor);
 				OnInteractorStopOverlap.Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
 				
 				return;
@@ -1434,7 +1795,7 @@ void UActorInteractableComponentBase::OnInteractableTraced(UPrimitiveComponent*
 	for (const auto& Itr : InteractorComponents)
 	{
 		TScriptInterface<IActorInteractorInterface> FoundInteractor;
-		if (IgnoredClasses.Contains(Itr->StaticClass())) continue;
+		if (GetResolvedIgnoredClasses().Contains(Itr->StaticClass())) continue;
 		
 		FoundInteractor = Itr;
 		FoundInteractor.SetObject(Itr);
@@ -1468,8 +1829,12 @@ void UActorInteractableComponentBase::OnInteractionProgressExpired(const float E
 	{
 		case EInteractableStateV2::EIS_Paused:
 			{
-				GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
-				GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+				if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
+				{
+					TimingSubsystem->ClearTimer(Timer_Interaction);
+					TimingSubsystem->ClearTimer(Timer_ProgressExpiration);
+				}
+				ResetInteractionClock();
 				
 				if (DoesHaveInteractor() && GetInteractor()->GetActiveInteractable() == this)
 				{
@@ -1503,6 +1868,9 @@ void UActorInteractableComponentBase::InteractableSelected(const TScriptInterfac
  	}
 	else
 	{
+		// Interactor releases its own slot once its Active Interactable changes, see ReleaseInteractorSlot
+		if (SlotInteractors.Num() > 1) return;
+		
 		OnInteractionCanceled.Broadcast();
 		
 		SetState(DefaultInteractableState);
@@ -1514,6 +1882,9 @@ void UActorInteractableComponentBase::InteractableLost(const TScriptInterface<IA
 {
 	if (Interactable == this)
 	{
+		// Interactor releases its own slot once its Active Interactable changes, see ReleaseInteractorSlot
+		if (SlotInteractors.Num() > 1) return;
+		
 		switch (GetState())
 		{
 			case EInteractableStateV2::EIS_Active:
@@ -1538,6 +1909,105 @@ void UActorInteractableComponentBase::InteractableLost(const TScriptInterface<IA
 	}
 }
 
+bool UActorInteractableComponentBase::AcquireInteractorSlot(const TScriptInterface<IActorInteractorInterface>& FoundInteractor)
+{
+	if (FoundInteractor.GetInterface() == nullptr) return false;
+
+	if (FindInteractorSlot(FoundInteractor) == INDEX_NONE)
+	{
+		if (SlotInteractors.Num() >= MaxConcurrentInteractors)
+		{
+			int32 EvictedSlot = INDEX_NONE;
+			switch (InteractorArbitration)
+			{
+				case EInteractorArbitration::EIA_ReplaceOldest:
+					// Interactor owns Interaction Timer, so it is never replaced while interacting
+					EvictedSlot = SlotStartTimes[0] >= 0.f ? (SlotInteractors.Num() > 1 ? 1 : INDEX_NONE) : 0;
+					break;
+				case EInteractorArbitration::EIA_ReplaceIdle:
+					EvictedSlot = SlotStartTimes.IndexOfByPredicate([](const float StartTime) { return StartTime < 0.f; });
+					break;
+				case EInteractorArbitration::EIA_KeepExisting:
+				case EInteractorArbitration::Default:
+				default: break;
+			}
+
+			if (EvictedSlot == INDEX_NONE) return false;
+			
+			EvictInteractorSlot(EvictedSlot);
+		}
+
+		AddInteractorSlot(FoundInteractor, SlotInteractors.Num());
+		if (Interactor.GetInterface() == nullptr)
+		{
+			Interactor = FoundInteractor;
+			BroadcastInteractorChanged(Interactor);
+		}
+	}
+	
+	FoundInteractor->GetOnInteractableSelectedHandle().AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractableSelected);
+	FoundInteractor->GetOnInteractableFoundHandle().Broadcast(this);
+	
+	return true;
+}
+
+void UActorInteractableComponentBase::EvictInteractorSlot(const int32 SlotIndex)
+{
+	if (!SlotInteractors.IsValidIndex(SlotIndex)) return;
+
+	const TScriptInterface<IActorInteractorInterface> EvictedInteractor = SlotInteractors[SlotIndex];
+	
+	RemoveInteractorSlot(SlotIndex);
+	HandOverInteractionClock(EvictedInteractor);
+	if (SlotIndex == 0)
+	{
+		Interactor = SlotInteractors.Num() > 0 ? SlotInteractors[0] : nullptr;
+		BroadcastInteractorChanged(Interactor);
+	}
+
+	if (EvictedInteractor.GetInterface() != nullptr)
+	{
+		// Unbind first, so Evicted Interactor releasing this Interactable does not affect other slots
+		EvictedInteractor->GetOnInteractableSelectedHandle().RemoveDynamic(this, &UActorInteractableComponentBase::InteractableSelected);
+		EvictedInteractor->GetOnInteractableLostHandle().RemoveDynamic(this, &UActorInteractableComponentBase::InteractableLost);
+		EvictedInteractor->GetOnInteractableLostHandle().Broadcast(this);
+	}
+}
+
+void UActorInteractableComponentBase::AddInteractorSlot(const TScriptInterface<IActorInteractorInterface>& NewInteractor, const int32 SlotIndex)
+{
+	SlotInteractors.Insert(NewInteractor, SlotIndex);
+	SlotStartTimes.Insert(-1.f, SlotIndex);
+	SlotKeys.Insert(FKey(), SlotIndex);
+	SlotProgress.Insert(0.f, SlotIndex);
+}
+
+void UActorInteractableComponentBase::RemoveInteractorSlot(const int32 SlotIndex)
+{
+	// Order is preserved, so slot 0 always belongs to Interactor and oldest slots come first
+	SlotInteractors.RemoveAt(SlotIndex, 1, false);
+	SlotStartTimes.RemoveAt(SlotIndex, 1, false);
+	SlotKeys.RemoveAt(SlotIndex, 1, false);
+	SlotProgress.RemoveAt(SlotIndex, 1, false);
+}
+
+void UActorInteractableComponentBase::ClearInteractorSlots()
+{
+	SlotInteractors.Reset();
+	SlotStartTimes.Reset();
+	SlotKeys.Reset();
+	SlotProgress.Reset();
+}
+
+void UActorInteractableComponentBase::ResetInteractorSlotsProgress()
+{
+	for (int32 i = 0; i < SlotInteractors.Num(); ++i)
+	{
+		SlotStartTimes[i] = -1.f;
+		SlotProgress[i] = 0.f;
+	}
+}
+
 void UActorInteractableComponentBase::FindAndAddCollisionShapes()
 {
 	for (const auto& Itr : CollisionOverrides)
@@ -1588,21 +2058,18 @@ bool UActorInteractableComponentBase::TriggerCooldown()
 		RemainingLifecycleCount = FMath::Max(0, TempRemainingLifecycleCount);
 	}
 	
-	if (GetWorld())
+	if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
 	{
 		if (RemainingLifecycleCount == 0) return false;
 
+		ResetInteractionClock();
 		SetState(EInteractableStateV2::EIS_Cooldown);
 
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActorInteractableComponentBase::OnCooldownCompletedCallback);
-		
-		GetWorld()->GetTimerManager().SetTimer
+		TimingSubsystem->SetTimer
 		(
 			Timer_Cooldown,
-			Delegate,
-			CooldownPeriod,
-			false
+			FSimpleDelegate::CreateUObject(this, &UActorInteractableComponentBase::OnCooldownCompletedCallback),
+			CooldownPeriod
 		);
 
 		for (const auto& Itr : CollisionComponents)
@@ -1617,8 +2084,123 @@ bool UActorInteractableComponentBase::TriggerCooldown()
 	return false;
 }
 
+UActorInteractionTimingSubsystem* UActorInteractableComponentBase::GetTimingSubsystem() const
+{
+	return GetWorld() ? GetWorld()->GetSubsystem<UActorInteractionTimingSubsystem>() : nullptr;
+}
+
+UActorInteractionPromptSubsystem* UActorInteractableComponentBase::FindPromptSubsystem() const
+{
+	const UActorComponent* InteractorComponent = Cast<UActorComponent>(GetInteractor().GetObject());
+	AActor* InteractorOwner = InteractorComponent ? InteractorComponent->GetOwner() : nullptr;
+
+	const APlayerController* PlayerController = Cast<APlayerController>(InteractorOwner);
+	if (PlayerController == nullptr)
+	{
+		if (const APawn* Pawn = Cast<APawn>(InteractorOwner))
+		{
+			PlayerController = Cast<APlayerController>(Pawn->GetController());
+		}
+	}
+
+	if (PlayerController == nullptr || !PlayerController->IsLocalController()) return nullptr;
+
+	const ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UActorInteractionPromptSubsystem>() : nullptr;
+}
+
+double UActorInteractableComponentBase::GetInteractionClockTime() const
+{
+	if (!GetWorld()) return 0.0;
+
+	if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return GetWorld()->GetTimeSeconds();
+}
+
+float UActorInteractableComponentBase::GetInteractionElapsed() const
+{
+	if (InteractionStartTime < 0.0) return 0.f;
+
+	if (IsInteractionClockPaused()) return static_cast<float>(InteractionPausedElapsed);
+
+	return static_cast<float>(FMath::Max(0.0, GetInteractionClockTime() - InteractionStartTime));
+}
+
+void UActorInteractableComponentBase::StartInteractionClock(const TScriptInterface<IActorInteractorInterface>& StartingInteractor)
+{
+	ClockInteractor = StartingInteractor;
+	
+	if (IsInteractionClockPaused())
+	{
+		InteractionStartTime = GetInteractionClockTime() - InteractionPausedElapsed;
+		InteractionPausedElapsed = -1.0;
+	}
+	else if (InteractionStartTime < 0.0)
+	{
+		InteractionStartTime = GetInteractionClockTime();
+	}
+
+	MarkWidgetDirty(EInteractableWidgetDirty::Progress);
+}
+
+void UActorInteractableComponentBase::PauseInteractionClock()
+{
+	if (InteractionStartTime < 0.0 || IsInteractionClockPaused()) return;
+
+	InteractionPausedElapsed = GetInteractionElapsed();
+	MarkWidgetDirty(EInteractableWidgetDirty::Progress);
+}
+
+void UActorInteractableComponentBase::ResetInteractionClock()
+{
+	ClockInteractor = nullptr;
+	if (InteractionStartTime < 0.0) return;
+	
+	InteractionStartTime = -1.0;
+	InteractionPausedElapsed = -1.0;
+	MarkWidgetDirty(EInteractableWidgetDirty::Progress);
+}
+
+void UActorInteractableComponentBase::HandOverInteractionClock(const TScriptInterface<IActorInteractorInterface>& ReleasingInteractor)
+{
+	if (ClockInteractor != ReleasingInteractor) return;
+
+	const int32 InteractingSlot = SlotStartTimes.IndexOfByPredicate([](const float StartTime) { return StartTime >= 0.f; });
+	ClockInteractor = SlotInteractors.IsValidIndex(InteractingSlot) ? SlotInteractors[InteractingSlot] : nullptr;
+}
+
+void UActorInteractableComponentBase::OnRep_InteractionClock()
+{
+	MarkWidgetDirty(EInteractableWidgetDirty::Progress);
+}
+
 void UActorInteractableComponentBase::ToggleWidgetVisibility(const bool IsVisible)
 {
+	if (PromptMode != EInteractablePromptMode::EIPM_WidgetComponent)
+	{
+		if (IsVisible)
+		{
+			ActivePromptSubsystem = FindPromptSubsystem();
+			if (UActorInteractionPromptSubsystem* PromptSubsystem = ActivePromptSubsystem.Get())
+			{
+				PromptSubsystem->ShowPrompt(this);
+			}
+		}
+		else
+		{
+			if (UActorInteractionPromptSubsystem* PromptSubsystem = ActivePromptSubsystem.Get())
+			{
+				PromptSubsystem->HidePrompt(this);
+			}
+			ActivePromptSubsystem.Reset();
+		}
+		return;
+	}
+	
 	if (GetWidget())
 	{
 		UpdateInteractionWidget();
@@ -1785,7 +2367,8 @@ void UActorInteractableComponentBase::OnCooldownCompletedCallback()
 	{
 		BindCollisionShape(Itr);
 	}
-	
+
+	InteractionCooldownCompleted();
 	OnCooldownCompleted.Broadcast();
 }
 
@@ -1810,22 +2393,64 @@ bool UActorInteractableComponentBase::ValidateInteractable() const
 
 void UActorInteractableComponentBase::UpdateInteractionWidget()
 {
-	if (UUserWidget* UserWidget = GetWidget() )
+	// Prompt Layer reads batched Interactables every frame, nothing to push
+	if (PromptMode == EInteractablePromptMode::EIPM_Batched) return;
+	
+	if (PromptMode == EInteractablePromptMode::EIPM_Pooled)
 	{
-		if (UserWidget->Implements<UActorInteractionWidget>())
-		{
-			TScriptInterface<IActorInteractionWidget> InteractionWidget = UserWidget;
-			InteractionWidget.SetObject(UserWidget);
-			InteractionWidget.SetInterface(Cast<IActorInteractionWidget>(UserWidget));
-
-			InteractionWidget->Execute_UpdateWidget(UserWidget, this);
-		}
-		else if (UActorInteractableWidget* InteractableWidget = Cast<UActorInteractableWidget>(UserWidget))
+		if (UActorInteractionPromptSubsystem* PromptSubsystem = ActivePromptSubsystem.Get())
 		{
-			InteractableWidget->InitializeInteractionWidget(FText::FromString("E"), FText::FromString("Object"), FText::FromString("Use"), nullptr, nullptr);
-			InteractableWidget->SetInteractionProgress(GetInteractionProgress());
+			PromptSubsystem->RefreshPrompt(this);
 		}
+		return;
+	}
+	
+	PushWidgetData(GetWidget());
+}
+
+void UActorInteractableComponentBase::PushWidgetData(UUserWidget* TargetWidget)
+{
+	if (TargetWidget == nullptr) return;
+
+	const float Timestamp = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	const float Progress = GetInteractionProgress();
+	const float ProgressRate = IsInteracting() ? GetInteractionPeriodInverse() : 0.f;
+	
+	if (TargetWidget->Implements<UActorInteractionWidget>())
+	{
+		TScriptInterface<IActorInteractionWidget> InteractionWidget = TargetWidget;
+		InteractionWidget.SetObject(TargetWidget);
+		InteractionWidget.SetInterface(Cast<IActorInteractionWidget>(TargetWidget));
+
+		InteractionWidget->Execute_UpdateWidget(TargetWidget, this);
+		InteractionWidget->Execute_SetProgressTiming(TargetWidget, Timestamp, Progress, ProgressRate);
 	}
+	else if (UActorInteractableWidget* InteractableWidget = Cast<UActorInteractableWidget>(TargetWidget))
+	{
+		InteractableWidget->InitializeInteractionWidget(FText::FromString("E"), FText::FromString("Object"), FText::FromString("Use"), nullptr, nullptr);
+		InteractableWidget->SetInteractionProgressTiming(Timestamp, Progress, ProgressRate);
+	}
+}
+
+void UActorInteractableComponentBase::MarkWidgetDirty(const EInteractableWidgetDirty DirtyFlags)
+{
+	if (!GetWorld()) return;
+	if (PromptMode == EInteractablePromptMode::EIPM_Batched) return;
+	
+	const bool bAlreadyPending = PendingWidgetUpdates != EInteractableWidgetDirty::None;
+	PendingWidgetUpdates |= DirtyFlags;
+
+	if (bAlreadyPending) return;
+
+	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UActorInteractableComponentBase::FlushWidgetUpdate);
+}
+
+void UActorInteractableComponentBase::FlushWidgetUpdate()
+{
+	if (PendingWidgetUpdates == EInteractableWidgetDirty::None) return;
+
+	PendingWidgetUpdates = EInteractableWidgetDirty::None;
+	UpdateInteractionWidget();
 }
 
 void UActorInteractableComponentBase::InteractableDependencyStartedCallback(const TScriptInterface<IActorInteractableInterface>& NewMaster)
@@ -1928,7 +2553,19 @@ void UActorInteractableComponentBase::PostEditChangeChainProperty(FPropertyChang
 			InteractionPeriod = 0.1f;
 		}
 	}
-		
+
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UActorInteractableComponentBase, bOverride_InteractionKeysPerPlatform))
+	{
+		// Start overriding from Keys which were used so far, clearing them afterwards is still allowed
+		if (bOverride_InteractionKeysPerPlatform && InteractionKeysPerPlatform.Num() == 0)
+		{
+			InteractionKeysPerPlatform = InteractableDefinition ? InteractableDefinition->GetInteractionKeysPerPlatform() : GetDefaultInteractionKeys();
+		}
+	}
+
+	// Keys might have changed through Definition, override or Keys themselves
+	InvalidateRunningPlatformKeys();
+
 	if (PropertyName == TEXT("WidgetClass"))
 	{
 		if (GetWidgetClass() == nullptr)
@@ -2044,7 +2681,8 @@ EDataValidationResult UActorInteractableComponentBase::IsDataValid(TArray<FText>
 		bAnyError = true;
 	}
 
-	if (GetWidgetClass() == nullptr)
+	// Batched Prompts are painted by Prompt Layer, which does not use Widget Class
+	if (GetWidgetClass() == nullptr && PromptMode != EInteractablePromptMode::EIPM_Batched)
 	{
 		const FText ErrorMessage = FText::FromString
 		(
@@ -2140,4 +2778,99 @@ void UActorInteractableComponentBase::DrawDebug()
 #endif
 #pragma endregion
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+void UActorInteractableComponentBase::BroadcastInteractableStateChanged(const EInteractableStateV2& NewState)
+{
+	if (HasBegunPlay()) OnInteractableStateChangedEvent(NewState);
+	
+	OnInteractableStateChangedNative.Broadcast(this, NewState);
+	OnInteractableStateChanged.Broadcast(NewState);
+}
+
+void UActorInteractableComponentBase::BroadcastInteractorChanged(const TScriptInterface<IActorInteractorInterface>& NewInteractor)
+{
+	if (HasBegunPlay()) OnInteractorChangedEvent(NewInteractor);
+	
+	OnInteractorChangedNative.Broadcast(this, NewInteractor);
+	OnInteractorChanged.Broadcast(NewInteractor);
+}
+
+void UActorInteractableComponentBase::ApplyInteractableDefinition()
+{
+	if (InteractableDefinition == nullptr) return;
+
+	if (!bOverride_InteractionPeriod) InteractionPeriod = InteractableDefinition->GetInteractionPeriod();
+	if (!bOverride_LifecycleMode) LifecycleMode = InteractableDefinition->GetLifecycleMode();
+	if (!bOverride_LifecycleCount) LifecycleCount = InteractableDefinition->GetLifecycleCount();
+	if (!bOverride_CooldownPeriod) CooldownPeriod = InteractableDefinition->GetCooldownPeriod();
+
+	InvalidateRunningPlatformKeys();
+}
+
+const TMap<FString, FInteractionKeySetup>& UActorInteractableComponentBase::GetResolvedInteractionKeys() const
+{
+	// Overridden Keys are used even if empty, cleared Keys must not fall back to class defaults
+	if (bOverride_InteractionKeysPerPlatform) return InteractionKeysPerPlatform;
+
+	if (InteractableDefinition) return InteractableDefinition->GetInteractionKeysPerPlatform();
+
+	return GetDefaultInteractionKeys();
+}
+
+TMap<FString, FInteractionKeySetup>& UActorInteractableComponentBase::GetMutableInteractionKeys()
+{
+	const TMap<FString, FInteractionKeySetup>& ResolvedKeys = GetResolvedInteractionKeys();
+	if (&ResolvedKeys != &InteractionKeysPerPlatform)
+	{
+		InteractionKeysPerPlatform = ResolvedKeys;
+	}
+
+	bOverride_InteractionKeysPerPlatform = true;
+
+	// Keys are modified through returned reference, Key set is resolved again once needed
+	InvalidateRunningPlatformKeys();
+	return InteractionKeysPerPlatform;
+}
+
+const TArray<TSoftClassPtr<UObject>>& UActorInteractableComponentBase::GetResolvedIgnoredClasses() const
+{
+	if (InteractableDefinition && !bOverride_IgnoredClasses) return InteractableDefinition->GetIgnoredClasses();
+
+	return IgnoredClasses;
+}
+
+TArray<TSoftClassPtr<UObject>>& UActorInteractableComponentBase::GetMutableIgnoredClasses()
+{
+	if (InteractableDefinition && !bOverride_IgnoredClasses)
+	{
+		IgnoredClasses = InteractableDefinition->GetIgnoredClasses();
+	}
+
+	bOverride_IgnoredClasses = true;
+	return IgnoredClasses;
+}
+
+const TMap<FString, FInteractionKeySetup>& UActorInteractableComponentBase::GetDefaultInteractionKeys() const
+{
+	static const TMap<FString, FInteractionKeySetup> DefaultKeys = []()
+	{
+		const FInteractionKeySetup GamepadKeys = FKey("Gamepad_FaceButton_Bottom");
+		FInteractionKeySetup KeyboardKeys = GamepadKeys;
+		KeyboardKeys.Keys.Add("E");
+
+		TMap<FString, FInteractionKeySetup> Keys;
+		Keys.Add((TEXT("Windows")), KeyboardKeys);
+		Keys.Add((TEXT("Mac")), KeyboardKeys);
+		Keys.Add((TEXT("PS4")), GamepadKeys);
+		Keys.Add((TEXT("XboxOne")), GamepadKeys);
+		return Keys;
+	}();
+
+	return DefaultKeys;
+}
+
+void UActorInteractableComponentBase::RefreshRunningPlatformKeys()
+{
+	RunningPlatformKeySet = FInteractionKeyTable::Get().FindOrAddKeySet(GetResolvedInteractionKeys());
+}
+
+#undef LOCTEXT_NAMESPACE
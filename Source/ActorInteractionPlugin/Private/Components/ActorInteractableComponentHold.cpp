@@ -2,7 +2,6 @@
 
 
 #include "Components/ActorInteractableComponentHold.h"
-#include "TimerManager.h"
 #include "Interfaces/ActorInteractorInterface.h"
 
 #include "Helpers/ActorInteractionPluginLog.h"
@@ -26,31 +25,31 @@ void UActorInteractableComponentHold::InteractionStarted(const float& TimeStarte
 {
 	Super::InteractionStarted(TimeStarted, PressedKey, CausingInteractor);
 	
-	if (!GetWorld()) return;
+	UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem();
+	if (!TimingSubsystem) return;
 	
 	if (CanInteract())
 	{
 		// Force Interaction Period to be at least 0.1s
 		const float TempInteractionPeriod = FMath::Max(0.1f, InteractionPeriod);
 
-		// Either unpause or start from start
-		if (GetWorld()->GetTimerManager().IsTimerPaused(Timer_Interaction))
+		// Other Interactor is already holding and keeps the clock
+		if (IsInteracting() && ClockInteractor.GetObject() != nullptr && ClockInteractor != CausingInteractor)
 		{
-			GetWorld()->GetTimerManager().UnPauseTimer(Timer_Interaction);
-		}
-		else
-		{
-			FTimerDelegate Delegate;
-			Delegate.BindUObject(this, &UActorInteractableComponentHold::OnInteractionCompletedCallback);
-
-			GetWorld()->GetTimerManager().SetTimer
-			(
-				Timer_Interaction,
-				Delegate,
-				TempInteractionPeriod,
-				false
-			);
+			return;
 		}
+
+		// Either resume from pause or start from start, pressing again while holding starts over
+		if (!IsInteractionClockPaused()) ResetInteractionClock();
+		const float Elapsed = IsInteractionClockPaused() ? GetInteractionElapsed() : 0.f;
+		StartInteractionClock(CausingInteractor);
+		
+		TimingSubsystem->SetTimer
+		(
+			Timer_Interaction,
+			FSimpleDelegate::CreateUObject(this, &UActorInteractableComponentHold::OnInteractionCompletedCallback),
+			FMath::Max(0.f, TempInteractionPeriod - Elapsed)
+		);
 	}
 }
 
@@ -93,7 +92,7 @@ void UActorInteractableComponentHold::OnInteractionCompletedCallback()
 		if (TriggerCooldown()) return;
 	}
 	
-	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), GetInteractor());
+	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), GetClockInteractor());
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -11,16 +11,25 @@ UActorInteractableComponentHover::UActorInteractableComponentHover()
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
 	InteractionPeriod = 3.f;
 	InteractableName = LOCTEXT("ActorInteractableComponentHover", "Hover");
+}
+
+const TMap<FString, FInteractionKeySetup>& UActorInteractableComponentHover::GetDefaultInteractionKeys() const
+{
+	static const TMap<FString, FInteractionKeySetup> DefaultKeys = []()
+	{
+		const FInteractionKeySetup GamepadKeys = FKey("Gamepad_FaceButton_Bottom");
+		FInteractionKeySetup KeyboardKeys = GamepadKeys;
+		KeyboardKeys.Keys.Add("LeftMouseButton");
+
+		TMap<FString, FInteractionKeySetup> Keys;
+		Keys.Add((TEXT("Windows")), KeyboardKeys);
+		Keys.Add((TEXT("Mac")), KeyboardKeys);
+		Keys.Add((TEXT("PS4")), GamepadKeys);
+		Keys.Add((TEXT("XboxOne")), GamepadKeys);
+		return Keys;
+	}();
 
-	InteractionKeysPerPlatform.Empty();
-	const FInteractionKeySetup GamepadKeys = FKey("Gamepad_FaceButton_Bottom");
-	FInteractionKeySetup KeyboardKeys = GamepadKeys;
-	KeyboardKeys.Keys.Add("LeftMouseButton");
-		
-	InteractionKeysPerPlatform.Add((TEXT("Windows")), KeyboardKeys);
-	InteractionKeysPerPlatform.Add((TEXT("Mac")), KeyboardKeys);
-	InteractionKeysPerPlatform.Add((TEXT("PS4")), GamepadKeys);
-	InteractionKeysPerPlatform.Add((TEXT("XboxOne")), GamepadKeys);
+	return DefaultKeys;
 }
 
 void UActorInteractableComponentHover::BeginPlay()
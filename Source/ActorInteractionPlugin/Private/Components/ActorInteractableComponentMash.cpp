@@ -2,7 +2,6 @@
 
 
 #include "Components/ActorInteractableComponentMash.h"
-#include "TimerManager.h"
 #include "Helpers/ActorInteractionPluginLog.h"
 
 #define LOCTEXT_NAMESPACE "ActorInteractableComponentMash"
@@ -47,65 +46,65 @@ void UActorInteractableComponentMash::OnInteractionCompletedCallback()
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
+	if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
+	{
+		TimingSubsystem->ClearTimer(TimerHandle_Mashed);
+	}
 	
 	if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
 	{
 		if (TriggerCooldown()) return;
 	}
 	
-	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), GetInteractor());
+	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), GetClockInteractor());
 }
 
 void UActorInteractableComponentMash::CleanupComponent()
 {
 	ActualMashAmount = 0;
 	
-	OnInteractableStateChanged.Broadcast(InteractableState);
+	BroadcastInteractableStateChanged(InteractableState);
 	
-	if (GetWorld())
+	if (UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
-		GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
+		TimingSubsystem->ClearTimer(TimerHandle_Mashed);
+		TimingSubsystem->ClearTimer(Timer_Interaction);
 	}
+	ResetInteractionClock();
 }
 
 void UActorInteractableComponentMash::InteractionStarted(const float& TimeStarted, const FKey& PressedKey, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
 	Super::InteractionStarted(TimeStarted, PressedKey, CausingInteractor);
+
+	UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem();
+	if (!TimingSubsystem) return;
 	
 	if (CanInteract())
 	{
-		if(!GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction))
+		if(!IsInteracting())
 		{
 			// Force Interaction Period to be at least 0.1s
 			const float TempInteractionPeriod = FMath::Max(0.1f, InteractionPeriod);
-	
-			FTimerDelegate Delegate_Completed;
-			Delegate_Completed.BindUObject(this, &UActorInteractableComponentMash::OnInteractionCompletedCallback);
 
-			GetWorld()->GetTimerManager().SetTimer
+			// Mashing always starts from start
+			ResetInteractionClock();
+			StartInteractionClock(CausingInteractor);
+
+			TimingSubsystem->SetTimer
 			(
 				Timer_Interaction,
-				Delegate_Completed,
-				TempInteractionPeriod,
-				false
+				FSimpleDelegate::CreateUObject(this, &UActorInteractableComponentMash::OnInteractionCompletedCallback),
+				TempInteractionPeriod
 			);
 		}
 
-		if (GetWorld()->GetTimerManager().IsTimerActive(TimerHandle_Mashed))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
-		}
-		
-		FTimerDelegate Delegate_Mashed;
-		Delegate_Mashed.BindUObject(this, &UActorInteractableComponentMash::OnInteractionFailedCallback);
-		GetWorld()->GetTimerManager().SetTimer
+		// Re-arming clears previous keystroke Timer, which is O(1) in Timing Wheel
+		TimingSubsystem->SetTimer
 		(
 			TimerHandle_Mashed,
-			Delegate_Mashed,
-			KeystrokeTimeThreshold,
-			false
+			FSimpleDelegate::CreateUObject(this, &UActorInteractableComponentMash::OnInteractionFailedCallback),
+			KeystrokeTimeThreshold
 		);
 		
 		ActualMashAmount++;
@@ -116,9 +115,9 @@ void UActorInteractableComponentMash::InteractionStarted(const float& TimeStarte
 
 void UActorInteractableComponentMash::InteractionStopped(const float& TimeStarted, const FKey& PressedKey, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
-	if (GetWorld())
+	if (const UActorInteractionTimingSubsystem* TimingSubsystem = GetTimingSubsystem())
 	{
-		if (!GetWorld()->GetTimerManager().IsTimerActive(TimerHandle_Mashed))
+		if (!TimingSubsystem->IsTimerActive(TimerHandle_Mashed))
 		{
 			Super::InteractionStopped(TimeStarted, PressedKey, CausingInteractor);
 		}
@@ -9,7 +9,12 @@
 #endif
 
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/ActorInteractionPluginStats.h"
 #include "Interfaces/ActorInteractableInterface.h"
+#include "Components/ActorInteractableComponentBase.h"
+#include "Components/SceneComponent.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Suppressed Selection Transitions (per frame)"), STAT_InteractionSuppressedTransitions, STATGROUP_MounteaInteraction);
 
 UActorInteractorComponentBase::UActorInteractorComponentBase()
 {
@@ -20,6 +25,13 @@ UActorInteractorComponentBase::UActorInteractorComponentBase()
 
 	InteractorState = EInteractorStateV2::EIS_Asleep;
 	DefaultInteractorState = EInteractorStateV2::EIS_Awake;
+
+	MinimumDwellTime = 0.f;
+	SelectionScoreMargin = 0.f;
+	ActiveInteractableSelectedTime = 0.f;
+	SuppressedSelectionTransitions = 0;
+	ScoringPolicy = nullptr;
+	MaxTopCandidates = 0;
 }
 
 void UActorInteractorComponentBase::BeginPlay()
@@ -124,7 +136,7 @@ void UActorInteractorComponentBase::EvaluateInteractable(const TScriptInterface<
 	 */
 	if (ActiveInteractable != FoundInteractable)
 	{
-		if (FoundInteractable->GetInteractableWeight() > ActiveInteractable->GetInteractableWeight())
+		if (ShouldReplaceActiveInteractable(FoundInteractable))
 		{
 			if (ActiveInteractable.GetInterface() != nullptr)
 			{
@@ -137,12 +149,10 @@ void UActorInteractorComponentBase::EvaluateInteractable(const TScriptInterface<
 		}
 		else
 		{
-			if (FoundInteractable.GetInterface() != nullptr)
-			{
-				OnInteractableLost.Broadcast(FoundInteractable);
-			}
-
-			OnInteractableSelected.Broadcast(ActiveInteractable);
+			NotifySelectionTransitionSuppressed();
+			
+			// Only release the Challenger, Active Interactable and listeners of this Interactor are not affected
+			FoundInteractable->GetOnInteractorLostHandle().Broadcast(this);
 		}
 	}
 	else
@@ -497,12 +507,20 @@ void UActorInteractorComponentBase::SetActiveInteractable(const TScriptInterface
 
 	if (NewInteractable.GetInterface() == nullptr && ActiveInteractable.GetInterface() != nullptr)
 	{
+		UActorInteractableComponentBase* OldInteractable = Cast<UActorInteractableComponentBase>(ActiveInteractable.GetObject());
+		
 		ActiveInteractable = NewInteractable;
+
+		if (OldInteractable)
+		{
+			OldInteractable->ReleaseInteractorSlot(this);
+		}
 	}
 
 	if (NewInteractable.GetInterface() != nullptr && ActiveInteractable.GetInterface() == nullptr)
 	{
 		ActiveInteractable = NewInteractable;
+		ActiveInteractableSelectedTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
 
 		OnInteractableSelected.Broadcast(ActiveInteractable);
 	}	
@@ -516,6 +534,179 @@ void UActorInteractorComponentBase::ToggleDebug()
 	DebugSettings.DebugMode = !DebugSettings.DebugMode;
 }
 
+bool UActorInteractorComponentBase::ShouldReplaceActiveInteractable(const TScriptInterface<IActorInteractableInterface>& Challenger) const
+{
+	if (Challenger.GetInterface() == nullptr) return false;
+	if (ActiveInteractable.GetInterface() == nullptr) return true;
+	if (Challenger == ActiveInteractable) return false;
+
+	// Scores of last update already reflect how Interactables were found, like hit points of Trace Interactors
+	const int32 BufferedActiveIndex = CandidateBuffer.Find(ActiveInteractable);
+	const int32 BufferedChallengerIndex = CandidateBuffer.Find(Challenger);
+	if (BufferedActiveIndex != INDEX_NONE && BufferedChallengerIndex != INDEX_NONE && CandidateBuffer.Scores.Num() >= CandidateBuffer.Num())
+	{
+		return IsSelectionTransitionAllowed(CandidateBuffer.Scores[BufferedChallengerIndex], CandidateBuffer.Scores[BufferedActiveIndex]);
+	}
+
+	SelectionCandidateBuffer.Reset();
+	const int32 ActiveIndex = GatherCandidate(ActiveInteractable, SelectionCandidateBuffer);
+	const int32 ChallengerIndex = GatherCandidate(Challenger, SelectionCandidateBuffer);
+	if (ActiveIndex == INDEX_NONE || ChallengerIndex == INDEX_NONE) return false;
+
+	ScoreCandidates(SelectionCandidateBuffer);
+
+	return IsSelectionTransitionAllowed(SelectionCandidateBuffer.Scores[ChallengerIndex], SelectionCandidateBuffer.Scores[ActiveIndex]);
+}
+
+bool UActorInteractorComponentBase::IsSelectionTransitionAllowed(const float ChallengerScore, const float ActiveScore) const
+{
+	if (MinimumDwellTime > 0.f && GetWorld())
+	{
+		if (GetWorld()->GetTimeSeconds() - ActiveInteractableSelectedTime < MinimumDwellTime) return false;
+	}
+
+	return ChallengerScore > ActiveScore + SelectionScoreMargin;
+}
+
+void UActorInteractorComponentBase::SetScoringPolicy(const TScriptInterface<IInteractionScoringPolicy>& NewPolicy)
+{
+	ScoringPolicy = NewPolicy;
+}
+
+int32 UActorInteractorComponentBase::GatherCandidate(const TScriptInterface<IActorInteractableInterface>& Interactable, FInteractionCandidateSoA& Candidates) const
+{
+	if (Interactable.GetInterface() == nullptr || GetOwner() == nullptr) return INDEX_NONE;
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	GetOwner()->GetActorEyesViewPoint(ViewLocation, ViewRotation);
+
+	FVector InteractableLocation;
+	if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Interactable.GetObject()))
+	{
+		InteractableLocation = SceneComponent->GetComponentLocation();
+	}
+	else if (const AActor* InteractableOwner = Interactable->GetInteractableOwner())
+	{
+		InteractableLocation = InteractableOwner->GetActorLocation();
+	}
+	else return INDEX_NONE;
+
+	const FVector ToInteractable = InteractableLocation - ViewLocation;
+	const float Distance = ToInteractable.Size();
+	const float ViewDot = Distance > KINDA_SMALL_NUMBER ? (ToInteractable / Distance) | ViewRotation.Vector() : 1.f;
+
+	return Candidates.Add(Interactable, INDEX_NONE, Distance, ViewDot, GetTimeSinceInteraction(Interactable));
+}
+
+float UActorInteractorComponentBase::GetTimeSinceInteraction(const TScriptInterface<IActorInteractableInterface>& Interactable) const
+{
+	const float LastInteractionTime = Interactable.GetInterface() ? Interactable->GetLastInteractionTime() : -1.f;
+	if (LastInteractionTime < 0.f || GetWorld() == nullptr) return TNumericLimits<float>::Max();
+
+	return GetWorld()->GetTimeSeconds() - LastInteractionTime;
+}
+
+void UActorInteractorComponentBase::ScoreCandidates(FInteractionCandidateSoA& Candidates) const
+{
+	Candidates.Pad();
+
+	if (const IInteractionScoringPolicy* Policy = ScoringPolicy.GetInterface())
+	{
+		Policy->ScoreCandidates(Candidates);
+	}
+	else
+	{
+		Candidates.Scores = Candidates.Weights;
+	}
+}
+
+void UActorInteractorComponentBase::SetMaxTopCandidates(const int32 NewMaxTopCandidates)
+{
+	MaxTopCandidates = FMath::Max(0, NewMaxTopCandidates);
+
+	if (TopCandidates.Num() > MaxTopCandidates)
+	{
+		TopCandidates.SetNum(MaxTopCandidates);
+		OnTopCandidatesChanged.Broadcast();
+	}
+}
+
+void UActorInteractorComponentBase::UpdateTopCandidates(const FInteractionCandidateSoA& Candidates)
+{
+	if (MaxTopCandidates <= 0 && TopCandidates.Num() == 0) return;
+
+	struct FRankedCandidate
+	{
+		int32 Index;
+		float Score;
+	};
+
+	// Worse candidate is on top of the heap, first gathered candidate wins ties
+	const auto IsWorse = [](const FRankedCandidate& A, const FRankedCandidate& B)
+	{
+		return A.Score < B.Score || (A.Score == B.Score && A.Index > B.Index);
+	};
+
+	TArray<FRankedCandidate, TInlineAllocator<8>> Heap;
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		const float Score = Candidates.Scores[i];
+
+		// Same Interactable might be hit by multiple Collision Components
+		const int32 DuplicateIndex = Heap.IndexOfByPredicate([&](const FRankedCandidate& Entry)
+		{
+			return Candidates.Interactables[Entry.Index] == Candidates.Interactables[i];
+		});
+		if (DuplicateIndex != INDEX_NONE)
+		{
+			if (Score > Heap[DuplicateIndex].Score)
+			{
+				Heap[DuplicateIndex].Score = Score;
+				Heap.Heapify(IsWorse);
+			}
+			continue;
+		}
+		
+		if (Heap.Num() < MaxTopCandidates)
+		{
+			Heap.HeapPush({i, Score}, IsWorse);
+		}
+		else if (Heap.Num() > 0 && IsWorse(Heap.HeapTop(), {i, Score}))
+		{
+			Heap.HeapPopDiscard(IsWorse, false);
+			Heap.HeapPush({i, Score}, IsWorse);
+		}
+	}
+
+	Heap.Sort([&IsWorse](const FRankedCandidate& A, const FRankedCandidate& B)
+	{
+		return IsWorse(B, A);
+	});
+
+	bool bChanged = Heap.Num() != TopCandidates.Num();
+	
+	TopCandidates.SetNum(Heap.Num());
+	for (int32 i = 0; i < Heap.Num(); ++i)
+	{
+		const FInteractionCandidate NewCandidate(Candidates.Interactables[Heap[i].Index], Heap[i].Score);
+		bChanged |= !(TopCandidates[i] == NewCandidate);
+		
+		TopCandidates[i] = NewCandidate;
+	}
+
+	if (bChanged)
+	{
+		OnTopCandidatesChanged.Broadcast();
+	}
+}
+
+void UActorInteractorComponentBase::NotifySelectionTransitionSuppressed()
+{
+	SuppressedSelectionTransitions++;
+	INC_DWORD_STAT(STAT_InteractionSuppressedTransitions);
+}
+
 #if WITH_EDITOR
 
 void UActorInteractorComponentBase::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
@@ -33,6 +33,111 @@ void UActorInteractorComponentOverlap::SetState(const EInteractorStateV2 NewStat
 	}
 }
 
+void UActorInteractorComponentOverlap::InteractableFound(const TScriptInterface<IActorInteractableInterface>& FoundInteractable)
+{
+	Super::InteractableFound(FoundInteractable);
+
+	if (FoundInteractable.GetInterface() == nullptr) return;
+	if (GetMaxTopCandidates() <= 0) return;
+	
+	if (!OverlappedInteractables.Contains(FoundInteractable))
+	{
+		OverlappedInteractables.Add(FoundInteractable);
+		FoundInteractable->GetInteractableStateChanged().AddUniqueDynamic(this, &UActorInteractorComponentOverlap::OnOverlappedInteractableStateChanged);
+	}
+	
+	RefreshTopCandidates();
+}
+
+void UActorInteractorComponentOverlap::InteractableLost(const TScriptInterface<IActorInteractableInterface>& LostInteractable)
+{
+	Super::InteractableLost(LostInteractable);
+
+	// Interactables which are no longer Active report Lost as well, those still overlapped stay candidates
+	if (!OverlappedInteractables.Contains(LostInteractable)) return;
+	if (IsOverlappingInteractable(LostInteractable)) return;
+
+	RemoveOverlappedInteractable(LostInteractable);
+	RefreshTopCandidates();
+}
+
+void UActorInteractorComponentOverlap::OnCollisionShapeEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	bool bAnyRemoved = false;
+	
+	for (int32 Index = OverlappedInteractables.Num() - 1; Index >= 0; --Index)
+	{
+		const TScriptInterface<IActorInteractableInterface> Itr = OverlappedInteractables[Index];
+		
+		const bool bIsStale = Itr.GetInterface() == nullptr;
+		if (!bIsStale)
+		{
+			if (Itr->GetInteractableOwner() != OtherActor) continue;
+			
+			// Other Collision Shape or other Collision Component of the same Interactable might still be overlapping
+			if (IsOverlappingInteractable(Itr)) continue;
+		}
+
+		RemoveOverlappedInteractable(Itr);
+		bAnyRemoved = true;
+	}
+
+	if (bAnyRemoved)
+	{
+		RefreshTopCandidates();
+	}
+}
+
+void UActorInteractorComponentOverlap::OnOverlappedInteractableStateChanged(const EInteractableStateV2& NewState)
+{
+	// Whether Interactable can be triggered might have changed, which filters candidates
+	RefreshTopCandidates();
+}
+
+bool UActorInteractorComponentOverlap::IsOverlappingInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable) const
+{
+	if (Interactable.GetInterface() == nullptr) return false;
+
+	// Overlapping Components of each Collision Shape are tracked per Component pair by engine
+	for (const UPrimitiveComponent* InteractableComponent : Interactable->GetCollisionComponents())
+	{
+		if (InteractableComponent == nullptr) continue;
+		
+		for (const UPrimitiveComponent* Shape : CollisionShapes)
+		{
+			if (Shape && Shape->IsOverlappingComponent(InteractableComponent)) return true;
+		}
+	}
+
+	return false;
+}
+
+void UActorInteractorComponentOverlap::RemoveOverlappedInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	if (Interactable.GetInterface())
+	{
+		Interactable->GetInteractableStateChanged().RemoveDynamic(this, &UActorInteractorComponentOverlap::OnOverlappedInteractableStateChanged);
+	}
+
+	OverlappedInteractables.Remove(Interactable);
+}
+
+void UActorInteractorComponentOverlap::RefreshTopCandidates()
+{
+	CandidateBuffer.Reset();
+	
+	for (const auto& Itr : OverlappedInteractables)
+	{
+		if (Itr.GetInterface() && Itr->CanBeTriggered())
+		{
+			GatherCandidate(Itr, CandidateBuffer);
+		}
+	}
+
+	ScoreCandidates(CandidateBuffer);
+	UpdateTopCandidates(CandidateBuffer);
+}
+
 UPrimitiveComponent* UActorInteractorComponentOverlap::FindComponentByName(const FName& CollisionComponentName)
 {
 	if (!GetOwner()) return nullptr;
@@ -83,6 +188,7 @@ void UActorInteractorComponentOverlap::BindCollision(UPrimitiveComponent* Compon
 	
 	Component->SetGenerateOverlapEvents(true);
 	Component->SetCollisionResponseToChannel(CollisionChannel, ECollisionResponse::ECR_Overlap);
+	Component->OnComponentEndOverlap.AddUniqueDynamic(this, &UActorInteractorComponentOverlap::OnCollisionShapeEndOverlap);
 
 	switch (Component->GetCollisionEnabled())
 	{
@@ -102,12 +208,24 @@ void UActorInteractorComponentOverlap::UnbindCollisions()
 	{
 		UnbindCollision(Itr);
 	}
+
+	if (OverlappedInteractables.Num() > 0)
+	{
+		for (int32 Index = OverlappedInteractables.Num() - 1; Index >= 0; --Index)
+		{
+			RemoveOverlappedInteractable(OverlappedInteractables[Index]);
+		}
+		
+		RefreshTopCandidates();
+	}
 }
 
 void UActorInteractorComponentOverlap::UnbindCollision(UPrimitiveComponent* Component)
 {
 	if(!Component) return;
 
+	Component->OnComponentEndOverlap.RemoveDynamic(this, &UActorInteractorComponentOverlap::OnCollisionShapeEndOverlap);
+
 	if (CachedCollisionShapesSettings.Find(Component))
 	{
 		Component->SetGenerateOverlapEvents(CachedCollisionShapesSettings[Component].bGenerateOverlapEvents);
@@ -9,6 +9,15 @@
 #include "Components/ShapeComponent.h"
 #include "Helpers/ActorInteractionPluginLog.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/ActorInteractionPluginStats.h"
+#include "Subsystems/ActorInteractionTraceSubsystem.h"
+#include "Subsystems/ActorInteractableRegistrySubsystem.h"
+#include "Components/ActorInteractableComponentBase.h"
+#include "Helpers/InteractionSignificanceProvider.h"
+#include "Algo/Sort.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trace Query (Multi Hit)"), STAT_InteractionTraceMultiHit, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Trace Query (Single Hit)"), STAT_InteractionTraceSingleHit, STATGROUP_MounteaInteraction);
 
 #if WITH_EDITOR
 #include "EditorHelper.h"
@@ -21,12 +30,35 @@ UActorInteractorComponentTrace::UActorInteractorComponentTrace()
 	TraceInterval = 0.01f;
 	TraceRange = 250.f;
 	TraceShapeHalfSize = 5.f;
+	SpatialConeHalfAngle = 15.f;
+	SpatialMaxConfirmations = 3;
 	bUseCustomStartTransform = false;
+	bUseAsyncTrace = false;
+	bUseSingleHitTrace = false;
+	InteractableObjectChannel = ECC_WorldDynamic;
+	bSingleHitBlockedByWorld = true;
+	bCollisionParamsDirty = true;
+
+	bUseAdaptiveTraceInterval = false;
+	AdaptiveLocationThreshold = 1.f;
+	AdaptiveRotationThreshold = 0.5f;
+	AdaptiveMaxTraceInterval = 0.2f;
+	EffectiveTraceInterval = TraceInterval;
+	bHasLastTraceViewpoint = false;
+
+	SignificanceProvider = nullptr;
+	SignificanceTraceInterval = 0.f;
+	bSuspendedBySignificance = false;
 }
 
 void UActorInteractorComponentTrace::BeginPlay()
 {
 	OnTraceDataChanged.AddUniqueDynamic(this, &UActorInteractorComponentTrace::OnTraceDataChangedEvent);
+	AsyncTraceDelegate.BindUObject(this, &UActorInteractorComponentTrace::OnAsyncTraceCompleted);
+
+	TraceBuffer.HitResults.Reserve(8);
+	
+	EffectiveTraceInterval = TraceInterval;
 
 	{
 		FTracingData NewData;
@@ -43,11 +75,24 @@ void UActorInteractorComponentTrace::BeginPlay()
 	Super::BeginPlay();
 }
 
+void UActorInteractorComponentTrace::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DisableTracing();
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 void UActorInteractorComponentTrace::DisableTracing()
 {
-	if (GetWorld())
+	AsyncTraceHandle = FTraceHandle();
+	bSuspendedBySignificance = false;
+	
+	if (const UWorld* World = GetWorld())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(Timer_Ticking);
+		if (UActorInteractionTraceSubsystem* TraceSubsystem = World->GetSubsystem<UActorInteractionTraceSubsystem>())
+		{
+			TraceSubsystem->UnregisterInteractor(this);
+		}
 	}
 }
 
@@ -67,143 +112,296 @@ void UActorInteractorComponentTrace::EnableTracing()
 			return;
 	}
 	
-	if (GetWorld())
+	if (const UWorld* World = GetWorld())
 	{
-		if(GetWorld()->GetTimerManager().IsTimerPaused(Timer_Ticking))
+		if (UActorInteractionTraceSubsystem* TraceSubsystem = World->GetSubsystem<UActorInteractionTraceSubsystem>())
 		{
-			GetWorld()->GetTimerManager().UnPauseTimer(Timer_Ticking);
+			TraceSubsystem->RegisterInteractor(this);
 		}
 		else
 		{
-			FTimerDelegate Delegate;
-			Delegate.BindUObject(this, &UActorInteractorComponentTrace::ProcessTrace);
-			
-			GetWorld()->GetTimerManager().SetTimer(Timer_Ticking, Delegate, FMath::Max(0.01f, TraceInterval), false);
+			AIntP_LOG(Warning, TEXT("[EnableTracing] No Trace Subsystem found in this World, tracing is not possible!"))
 		}
 	}
 }
 
 void UActorInteractorComponentTrace::PauseTracing()
 {
-	if (GetWorld())
+	if (const UWorld* World = GetWorld())
 	{
-		GetWorld()->GetTimerManager().PauseTimer(Timer_Ticking);
+		if (UActorInteractionTraceSubsystem* TraceSubsystem = World->GetSubsystem<UActorInteractionTraceSubsystem>())
+		{
+			TraceSubsystem->SetInteractorPaused(this, true);
+		}
 	}
 }
 
 void UActorInteractorComponentTrace::ResumeTracing()
 {
+	// Resume requested by anyone ends suspension, so next suspending tier can pause tracing again
+	bSuspendedBySignificance = false;
+	
 	EnableTracing();
 }
 
 void UActorInteractorComponentTrace::ProcessTrace()
+{
+	LLM_SCOPE_BYTAG(MounteaInteraction_Trace);
+	
+	if (!PrepareTrace(TraceBuffer)) return;
+
+	if (ExecuteTrace(TraceBuffer))
+	{
+		ResolveTrace(TraceBuffer);
+	}
+}
+
+bool UActorInteractorComponentTrace::PrepareTrace(FInteractionTraceDataV2& InteractionTraceData)
 {
 	if (!CanTrace())
 	{
 		DisableTracing();
+		return false;
 	}
+
+	if (GetOwner() == nullptr) return false;
 	
-	AddIgnoredActor(GetOwner());
+	InteractionTraceData.CollisionChannel = GetResponseChannel();
+	InteractionTraceData.HitResults.Reset();
+
+	InteractionTraceData.CollisionParams = &GetTraceCollisionParams();
+	InteractionTraceData.ObjectQueryParams = &CachedObjectQueryParams;
+
+	GetTraceViewpoint(InteractionTraceData.StartLocation, InteractionTraceData.TraceRotation);
 	
-	FInteractionTraceDataV2 TraceData;
+	const FVector DirectionVector = UKismetMathLibrary::GetForwardVector(InteractionTraceData.TraceRotation);
+	InteractionTraceData.EndLocation = (DirectionVector * TraceRange) + InteractionTraceData.StartLocation;
+
+	UpdateAdaptiveTraceInterval(InteractionTraceData.StartLocation, InteractionTraceData.TraceRotation);
+
+	return true;
+}
+
+void UActorInteractorComponentTrace::GetTraceViewpoint(FVector& OutLocation, FRotator& OutRotation) const
+{
+	if (bUseCustomStartTransform)
 	{
-		TraceData.CollisionChannel = GetResponseChannel();
-	
-		TraceData.CollisionParams.AddIgnoredActors(ListOfIgnoredActors);
-		TraceData.CollisionParams.MobilityType = EQueryMobilityType::Any;
-		TraceData.CollisionParams.bReturnPhysicalMaterial = true;
-	
-		FVector DirectionVector;
-		if (bUseCustomStartTransform)
+		OutLocation = CustomTraceTransform.GetLocation();
+		OutRotation = CustomTraceTransform.GetRotation().Rotator();
+	}
+	else if (GetOwner())
+	{
+		GetOwner()->GetActorEyesViewPoint(OutLocation, OutRotation);
+	}
+}
+
+bool UActorInteractorComponentTrace::HasTraceViewpointMoved(const FVector& Location, const FRotator& Rotation) const
+{
+	if (!bHasLastTraceViewpoint) return true;
+
+	return
+		FVector::DistSquared(Location, LastTraceViewpointLocation) > FMath::Square(AdaptiveLocationThreshold) ||
+		!Rotation.Equals(LastTraceViewpointRotation, AdaptiveRotationThreshold);
+}
+
+void UActorInteractorComponentTrace::UpdateAdaptiveTraceInterval(const FVector& Location, const FRotator& Rotation)
+{
+	if (!bUseAdaptiveTraceInterval)
+	{
+		EffectiveTraceInterval = TraceInterval;
+		return;
+	}
+
+	if (HasTraceViewpointMoved(Location, Rotation))
+	{
+		EffectiveTraceInterval = TraceInterval;
+	}
+	else
+	{
+		EffectiveTraceInterval = FMath::Min(EffectiveTraceInterval * 2.f, FMath::Max(TraceInterval, AdaptiveMaxTraceInterval));
+	}
+
+	LastTraceViewpointLocation = Location;
+	LastTraceViewpointRotation = Rotation;
+	bHasLastTraceViewpoint = true;
+}
+
+void UActorInteractorComponentTrace::UpdateSignificance()
+{
+	if (SignificanceProvider == nullptr) return;
+
+	const FInteractionSignificance Significance = SignificanceProvider->EvaluateSignificance(this);
+	const FInteractionTraceTier Tier = SignificanceProvider->SelectTraceTier(Significance);
+
+	if (Tier.bSuspendTracing)
+	{
+		if (bSuspendedBySignificance) return;
+
+		// Do not take over pause requested by anyone else
+		const UActorInteractionTraceSubsystem* TraceSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UActorInteractionTraceSubsystem>() : nullptr;
+		if (TraceSubsystem == nullptr || !TraceSubsystem->IsInteractorTracing(this)) return;
+		
+		PauseTracing();
+		bSuspendedBySignificance = true;
+		return;
+	}
+
+	SignificanceTraceInterval = Tier.TraceInterval;
+
+	if (bSuspendedBySignificance)
+	{
+		ResumeTracing();
+	}
+}
+
+bool UActorInteractorComponentTrace::ShouldTraceEarly() const
+{
+	// Only stretched interval can be cut short
+	if (!bUseAdaptiveTraceInterval || EffectiveTraceInterval <= TraceInterval) return false;
+
+	FVector Location;
+	FRotator Rotation;
+	GetTraceViewpoint(Location, Rotation);
+
+	return HasTraceViewpointMoved(Location, Rotation);
+}
+
+const FCollisionQueryParams& UActorInteractorComponentTrace::GetTraceCollisionParams()
+{
+	if (bCollisionParamsDirty)
+	{
+		CachedCollisionParams = FCollisionQueryParams(SCENE_QUERY_STAT(InteractionTrace), TraceQueryProfile.bTraceComplex, GetOwner());
+		CachedCollisionParams.AddIgnoredActors(ListOfIgnoredActors);
+		CachedCollisionParams.bReturnPhysicalMaterial = TraceQueryProfile.bReturnPhysicalMaterial;
+		CachedCollisionParams.bReturnFaceIndex = TraceQueryProfile.bReturnFaceIndex;
+
+		switch (TraceQueryProfile.MobilityFilter)
 		{
-			TraceData.StartLocation = CustomTraceTransform.GetLocation();
-			TraceData.TraceRotation = CustomTraceTransform.GetRotation().Rotator();
-			DirectionVector = UKismetMathLibrary::GetForwardVector(TraceData.TraceRotation);
-			TraceData.EndLocation = (DirectionVector * TraceRange) + CustomTraceTransform.GetLocation();
+			case EInteractionQueryMobility::EIQM_Static:
+				CachedCollisionParams.MobilityType = EQueryMobilityType::Static;
+				break;
+			case EInteractionQueryMobility::EIQM_Dynamic:
+				CachedCollisionParams.MobilityType = EQueryMobilityType::Dynamic;
+				break;
+			case EInteractionQueryMobility::EIQM_Any:
+			case EInteractionQueryMobility::Default:
+			default:
+				CachedCollisionParams.MobilityType = EQueryMobilityType::Any;
+				break;
 		}
-		else
+
+		CachedObjectQueryParams = FCollisionObjectQueryParams(InteractableObjectChannel.GetValue());
+		if (bSingleHitBlockedByWorld)
 		{
-			GetOwner()->GetActorEyesViewPoint(TraceData.StartLocation, TraceData.TraceRotation);
-		
-			DirectionVector = UKismetMathLibrary::GetForwardVector(TraceData.TraceRotation);
-			TraceData.EndLocation = (DirectionVector * TraceRange) + TraceData.StartLocation;
+			CachedObjectQueryParams.AddObjectTypesToQuery(ECC_WorldStatic);
+			CachedObjectQueryParams.AddObjectTypesToQuery(ECC_WorldDynamic);
 		}
+
+		bCollisionParamsDirty = false;
 	}
 
+	return CachedCollisionParams;
+}
+
+bool UActorInteractorComponentTrace::ExecuteTrace(FInteractionTraceDataV2& InteractionTraceData)
+{
 #if WITH_EDITOR
 	if(DebugSettings.DebugMode)
 	{
-		DrawTracingDebugStart(TraceData);
+		DrawTracingDebugStart(InteractionTraceData);
 	}
 #endif
+
+	// Spatial Tracing is only confirming a few candidates, no need to defer it
+	if (bUseAsyncTrace && TraceType != ETraceType::ETT_Spatial)
+	{
+		ProcessTrace_Async(InteractionTraceData);
+		return false;
+	}
 	
 	switch (TraceType)
 	{
 		case ETraceType::ETT_Precise:
-			ProcessTrace_Precise(TraceData);
+			ProcessTrace_Precise(InteractionTraceData);
 			break;
 		case ETraceType::ETT_Loose:
-			ProcessTrace_Loose(TraceData);
+			ProcessTrace_Loose(InteractionTraceData);
+			break;
+		case ETraceType::ETT_Spatial:
+			ProcessTrace_Spatial(InteractionTraceData);
 			break;
 		case ETraceType::Default:
 		default: break;
 	}
 
-	bool bAnyInteractable = false;
-	bool bFoundActiveAgain = false;
+	return true;
+}
+
+void UActorInteractorComponentTrace::ResolveTrace(FInteractionTraceDataV2& InteractionTraceData)
+{
+	const UActorInteractableRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UActorInteractableRegistrySubsystem>() : nullptr;
+	if (Registry == nullptr) return;
+
+	CandidateBuffer.Reset();
 	
-	FHitResult BestHitResult;
-	TScriptInterface<IActorInteractableInterface> BestInteractable = nullptr;
+	const FVector TraceStart = InteractionTraceData.StartLocation;
+	const FVector TraceDirection = (InteractionTraceData.EndLocation - InteractionTraceData.StartLocation).GetSafeNormal();
 	
-	for (FHitResult& HitResult : TraceData.HitResults)
+	for (int32 HitIndex = 0; HitIndex < InteractionTraceData.HitResults.Num(); ++HitIndex)
 	{
-		if (HitResult.GetComponent() == nullptr) continue;
-		if (const AActor* HitActor = HitResult.GetActor())
+		const FHitResult& HitResult = InteractionTraceData.HitResults[HitIndex];
+		
+		const FInteractableList* HitInteractables = FindHitInteractables(Registry, HitResult);
+		if (HitInteractables == nullptr) continue;
+		
+		for (const auto& Itr : *HitInteractables)
 		{
-			auto InteractableComponents = HitActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass());
-			for (const auto& Itr : InteractableComponents)
+			UObject* InteractableObject = Itr.Get();
+			if (InteractableObject == nullptr) continue;
+			
+			TScriptInterface<IActorInteractableInterface> Interactable;
+			Interactable.SetObject(InteractableObject);
+			Interactable.SetInterface(Cast<IActorInteractableInterface>(InteractableObject));
+			if (Interactable.GetInterface() == nullptr) continue;
+
+			const bool bCanTraceWith =
+			(
+				Interactable->GetCollisionChannel() == GetResponseChannel() &&
+				Interactable->CanBeTriggered()
+			);
+			
+			if (bCanTraceWith)
 			{
-				if (Itr && Itr->Implements<UActorInteractableInterface>())
-				{
-					TScriptInterface<IActorInteractableInterface> Interactable = Itr;
-					Interactable.SetObject(Itr);
-					Interactable.SetInterface(Cast<IActorInteractableInterface>(Itr));
-
-					const bool bCanTraceWith =
-					(
-						Interactable->GetCollisionComponents().Contains(HitResult.GetComponent()) &&
-						Interactable->GetCollisionChannel() == GetResponseChannel() &&
-						Interactable->CanBeTriggered()
-					);
-					
-					if (bCanTraceWith)
-					{
-						bAnyInteractable = true;
-
-						if (Interactable == GetActiveInteractable())
-						{
-							bFoundActiveAgain = true;
-						}
-
-						if (BestInteractable.GetObject() == nullptr)
-						{
-							BestInteractable = Interactable;
-							BestHitResult = HitResult;
-						}
-						else
-						{
-							if (Interactable->GetInteractableWeight() > BestInteractable->GetInteractableWeight())
-							{
-								BestInteractable = Interactable;
-								BestHitResult = HitResult;
-							}
-						}
-					}
-				}
+				const FVector ToHit = HitResult.ImpactPoint - TraceStart;
+				const float Distance = ToHit.Size();
+				const float ViewDot = Distance > KINDA_SMALL_NUMBER ? (ToHit / Distance) | TraceDirection : 1.f;
+				
+				CandidateBuffer.Add(Interactable, HitIndex, Distance, ViewDot, GetTimeSinceInteraction(Interactable));
 			}
 		}
 	}
+
+	const bool bAnyInteractable = CandidateBuffer.Num() > 0;
+	const int32 ActiveIndex = CandidateBuffer.Find(GetActiveInteractable());
+	const bool bFoundActiveAgain = ActiveIndex != INDEX_NONE;
+	
+	int32 BestIndex = INDEX_NONE;
+	if (bAnyInteractable)
+	{
+		ScoreCandidates(CandidateBuffer);
+		BestIndex = CandidateBuffer.FindBest();
+	}
+
+	UpdateTopCandidates(CandidateBuffer);
 		
+	// Keep Active Interactable unless best one wins by Selection Hysteresis, so no Lost/Selected pair is broadcast every trace
+	if (bFoundActiveAgain && BestIndex != ActiveIndex && !IsSelectionTransitionAllowed(CandidateBuffer.Scores[BestIndex], CandidateBuffer.Scores[ActiveIndex]))
+	{
+		NotifySelectionTransitionSuppressed();
+		
+		BestIndex = ActiveIndex;
+	}
+	
 	if (bAnyInteractable == false)
 	{
 		OnInteractableLost.Broadcast(GetActiveInteractable());
@@ -215,30 +413,78 @@ void UActorInteractorComponentTrace::ProcessTrace()
 	
 	if (bAnyInteractable)
 	{
-		BestInteractable->GetOnInteractorTracedHandle().Broadcast(BestHitResult.GetComponent(), GetOwner(), nullptr, BestHitResult.Location, BestHitResult);
+		const FHitResult& BestHitResult = InteractionTraceData.HitResults[CandidateBuffer.SourceIndices[BestIndex]];
+		CandidateBuffer.Interactables[BestIndex]->GetOnInteractorTracedHandle().Broadcast(BestHitResult.GetComponent(), GetOwner(), nullptr, BestHitResult.Location, BestHitResult);
 	}
 
 #if WITH_EDITOR
 	if (DebugSettings.DebugMode)
 	{
-		DrawTracingDebugEnd(TraceData);
+		DrawTracingDebugEnd(InteractionTraceData);
 	}
 #endif
-	
-	ResumeTracing();
+}
 
+const FInteractableList* UActorInteractorComponentTrace::FindHitInteractables(const UActorInteractableRegistrySubsystem* Registry, const FHitResult& HitResult)
+{
+	const UPrimitiveComponent* HitComponent = HitResult.GetComponent();
+	if (HitComponent == nullptr) return nullptr;
 	
+	if (const FInteractableList* RegisteredInteractables = Registry->FindInteractables(HitComponent))
+	{
+		return RegisteredInteractables;
+	}
+
+	const AActor* HitActor = HitResult.GetActor();
+	if (HitActor == nullptr) return nullptr;
+
+	UnregisteredHitInteractables.Reset();
+	HitActor->ForEachComponent(false, [this, HitComponent](UActorComponent* Component)
+	{
+		if (!Component->Implements<UActorInteractableInterface>()) return;
+
+		const IActorInteractableInterface* Interactable = Cast<IActorInteractableInterface>(Component);
+		if (Interactable && Interactable->GetCollisionComponents().Contains(HitComponent))
+		{
+			UnregisteredHitInteractables.Add(Component);
+		}
+	});
+
+	return UnregisteredHitInteractables.Num() > 0 ? &UnregisteredHitInteractables : nullptr;
 }
 
 void UActorInteractorComponentTrace::ProcessTrace_Precise(FInteractionTraceDataV2& InteractionTraceData)
 {
+	if (bUseSingleHitTrace)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSingleHit);
+		
+		FHitResult HitResult;
+		const bool bHit = GetWorld()->LineTraceSingleByObjectType
+		(
+			HitResult,
+			InteractionTraceData.StartLocation,
+			InteractionTraceData.EndLocation,
+			*InteractionTraceData.ObjectQueryParams,
+			*InteractionTraceData.CollisionParams
+		);
+
+		if (bHit)
+		{
+			InteractionTraceData.HitResults.Add(HitResult);
+		}
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionTraceMultiHit);
+	
 	GetWorld()->LineTraceMultiByChannel
 	(
 		InteractionTraceData.HitResults,
 		InteractionTraceData.StartLocation,
 		InteractionTraceData.EndLocation,
 		InteractionTraceData.CollisionChannel,
-		InteractionTraceData.CollisionParams
+		*InteractionTraceData.CollisionParams
 	);
 }
 
@@ -246,6 +492,31 @@ void UActorInteractorComponentTrace::ProcessTrace_Loose(FInteractionTraceDataV2&
 {
 	const FCollisionShape CollisionShape = FCollisionShape::MakeBox(FVector(TraceShapeHalfSize));
 
+	if (bUseSingleHitTrace)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSingleHit);
+		
+		FHitResult HitResult;
+		const bool bHit = GetWorld()->SweepSingleByObjectType
+		(
+			HitResult,
+			InteractionTraceData.StartLocation,
+			InteractionTraceData.EndLocation,
+			InteractionTraceData.TraceRotation.Quaternion(),
+			*InteractionTraceData.ObjectQueryParams,
+			CollisionShape,
+			*InteractionTraceData.CollisionParams
+		);
+
+		if (bHit)
+		{
+			InteractionTraceData.HitResults.Add(HitResult);
+		}
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionTraceMultiHit);
+
 	GetWorld()->SweepMultiByChannel
 	(
 		InteractionTraceData.HitResults,
@@ -254,10 +525,178 @@ void UActorInteractorComponentTrace::ProcessTrace_Loose(FInteractionTraceDataV2&
 		InteractionTraceData.TraceRotation.Quaternion(),
 		InteractionTraceData.CollisionChannel,
 		CollisionShape,
-		InteractionTraceData.CollisionParams
+		*InteractionTraceData.CollisionParams
 	);
 }
 
+void UActorInteractorComponentTrace::ProcessTrace_Spatial(FInteractionTraceDataV2& InteractionTraceData)
+{
+	const UActorInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UActorInteractableRegistrySubsystem>();
+	if (Registry == nullptr) return;
+
+	const FVector TraceDirection = (InteractionTraceData.EndLocation - InteractionTraceData.StartLocation).GetSafeNormal();
+	const FVector TraceStart = InteractionTraceData.StartLocation;
+
+	SpatialCandidates.Reset();
+	Registry->QueryCone(TraceStart, TraceDirection, TraceRange, SpatialConeHalfAngle, SpatialCandidates);
+
+	SpatialCandidates.RemoveAllSwap([this](const UActorInteractableComponentBase* Candidate)
+	{
+		return Candidate->GetCollisionChannel() != GetResponseChannel() || !Candidate->CanBeTriggered();
+	}, false);
+
+	// Heaviest first, then closest to view direction
+	Algo::Sort(SpatialCandidates, [&TraceStart, &TraceDirection](const UActorInteractableComponentBase* A, const UActorInteractableComponentBase* B)
+	{
+		if (A->GetInteractableWeight() != B->GetInteractableWeight())
+		{
+			return A->GetInteractableWeight() > B->GetInteractableWeight();
+		}
+
+		const FVector ToA = (A->GetComponentLocation() - TraceStart).GetSafeNormal();
+		const FVector ToB = (B->GetComponentLocation() - TraceStart).GetSafeNormal();
+		return (ToA | TraceDirection) > (ToB | TraceDirection);
+	});
+
+	const int32 NumConfirmations = FMath::Min(SpatialCandidates.Num(), FMath::Max(1, SpatialMaxConfirmations));
+	for (int32 Index = 0; Index < NumConfirmations; ++Index)
+	{
+		const UActorInteractableComponentBase* Candidate = SpatialCandidates[Index];
+		
+		const FVector ConfirmationEnd = TraceStart + (GetSpatialConfirmationTarget(Candidate, TraceStart, TraceDirection) - TraceStart).GetSafeNormal() * TraceRange;
+
+		FHitResult HitResult;
+		const bool bHit = GetWorld()->LineTraceSingleByChannel
+		(
+			HitResult,
+			TraceStart,
+			ConfirmationEnd,
+			InteractionTraceData.CollisionChannel,
+			*InteractionTraceData.CollisionParams
+		);
+
+		if (!bHit) continue;
+
+		// Only first blocking hit counts, anything else in between blocks line of sight
+		const FInteractableList* HitInteractables = FindHitInteractables(Registry, HitResult);
+		if (HitInteractables && HitInteractables->Contains(Candidate))
+		{
+			InteractionTraceData.HitResults.Add(HitResult);
+		}
+	}
+}
+
+FVector UActorInteractorComponentTrace::GetSpatialConfirmationTarget(const UActorInteractableComponentBase* Candidate, const FVector& TraceStart, const FVector& TraceDirection) const
+{
+	// Interactable Component itself does not need to lie inside any of its Collision Components
+	FVector BestTarget = Candidate->GetComponentLocation();
+	float BestViewDot = -2.f;
+	
+	for (const UPrimitiveComponent* Itr : Candidate->GetCollisionComponents())
+	{
+		if (Itr == nullptr) continue;
+
+		const FVector BoundsOrigin = Itr->Bounds.Origin;
+		const float ViewDot = (BoundsOrigin - TraceStart).GetSafeNormal() | TraceDirection;
+		if (ViewDot > BestViewDot)
+		{
+			BestViewDot = ViewDot;
+			BestTarget = BoundsOrigin;
+		}
+	}
+
+	return BestTarget;
+}
+
+void UActorInteractorComponentTrace::ProcessTrace_Async(FInteractionTraceDataV2& InteractionTraceData)
+{
+	switch (TraceType)
+	{
+		case ETraceType::ETT_Precise:
+			if (bUseSingleHitTrace)
+			{
+				AsyncTraceHandle = GetWorld()->AsyncLineTraceByObjectType
+				(
+					EAsyncTraceType::Single,
+					InteractionTraceData.StartLocation,
+					InteractionTraceData.EndLocation,
+					*InteractionTraceData.ObjectQueryParams,
+					*InteractionTraceData.CollisionParams,
+					&AsyncTraceDelegate
+				);
+			}
+			else
+			{
+				AsyncTraceHandle = GetWorld()->AsyncLineTraceByChannel
+				(
+					EAsyncTraceType::Multi,
+					InteractionTraceData.StartLocation,
+					InteractionTraceData.EndLocation,
+					InteractionTraceData.CollisionChannel,
+					*InteractionTraceData.CollisionParams,
+					FCollisionResponseParams::DefaultResponseParam,
+					&AsyncTraceDelegate
+				);
+			}
+			break;
+		case ETraceType::ETT_Loose:
+			if (bUseSingleHitTrace)
+			{
+				AsyncTraceHandle = GetWorld()->AsyncSweepByObjectType
+				(
+					EAsyncTraceType::Single,
+					InteractionTraceData.StartLocation,
+					InteractionTraceData.EndLocation,
+					InteractionTraceData.TraceRotation.Quaternion(),
+					*InteractionTraceData.ObjectQueryParams,
+					FCollisionShape::MakeBox(FVector(TraceShapeHalfSize)),
+					*InteractionTraceData.CollisionParams,
+					&AsyncTraceDelegate
+				);
+			}
+			else
+			{
+				AsyncTraceHandle = GetWorld()->AsyncSweepByChannel
+				(
+					EAsyncTraceType::Multi,
+					InteractionTraceData.StartLocation,
+					InteractionTraceData.EndLocation,
+					InteractionTraceData.TraceRotation.Quaternion(),
+					InteractionTraceData.CollisionChannel,
+					FCollisionShape::MakeBox(FVector(TraceShapeHalfSize)),
+					*InteractionTraceData.CollisionParams,
+					FCollisionResponseParams::DefaultResponseParam,
+					&AsyncTraceDelegate
+				);
+			}
+			break;
+		case ETraceType::ETT_Spatial:
+		case ETraceType::Default:
+		default: break;
+	}
+}
+
+void UActorInteractorComponentTrace::OnAsyncTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	// Tracing could have been disabled or restarted meanwhile
+	if (TraceHandle != AsyncTraceHandle) return;
+
+	AsyncTraceHandle = FTraceHandle();
+
+	if (!CanTrace()) return;
+
+	LLM_SCOPE_BYTAG(MounteaInteraction_Trace);
+
+	// Swap buffers instead of copying, both keep their capacity for next traces
+	TraceBuffer.StartLocation = TraceDatum.Start;
+	TraceBuffer.EndLocation = TraceDatum.End;
+	TraceBuffer.TraceRotation = TraceDatum.Rot.Rotator();
+	TraceBuffer.CollisionChannel = TraceDatum.TraceChannel;
+	Swap(TraceBuffer.HitResults, TraceDatum.OutHits);
+
+	ResolveTrace(TraceBuffer);
+}
+
 bool UActorInteractorComponentTrace::CanTrace() const
 {
 	return CanInteract();
@@ -290,6 +729,7 @@ void UActorInteractorComponentTrace::SetTraceInterval(const float NewInterval)
 	LastTracingData = NewData;
 	
 	TraceInterval = NewData.TracingInterval;
+	EffectiveTraceInterval = TraceInterval;
 	OnTraceDataChanged.Broadcast(NewData, OldData);
 }
 
@@ -338,6 +778,69 @@ void UActorInteractorComponentTrace::SetUseCustomStartTransform(const bool bUse)
 	OnTraceDataChanged.Broadcast(NewData, OldData);
 }
 
+FInteractionTraceQueryProfile UActorInteractorComponentTrace::GetTraceQueryProfile() const
+{ return TraceQueryProfile; }
+
+void UActorInteractorComponentTrace::SetTraceQueryProfile(const FInteractionTraceQueryProfile& NewProfile)
+{
+	if (TraceQueryProfile == NewProfile) return;
+	
+	TraceQueryProfile = NewProfile;
+	bCollisionParamsDirty = true;
+}
+
+bool UActorInteractorComponentTrace::GetUseSingleHitTrace() const
+{ return bUseSingleHitTrace; }
+
+void UActorInteractorComponentTrace::SetUseSingleHitTrace(const bool bUse)
+{
+	bUseSingleHitTrace = bUse;
+	AsyncTraceHandle = FTraceHandle();
+}
+
+UInteractionSignificanceProvider* UActorInteractorComponentTrace::GetSignificanceProvider() const
+{ return SignificanceProvider; }
+
+void UActorInteractorComponentTrace::SetSignificanceProvider(UInteractionSignificanceProvider* NewProvider)
+{
+	SignificanceProvider = NewProvider;
+	SignificanceTraceInterval = 0.f;
+
+	if (SignificanceProvider == nullptr && bSuspendedBySignificance)
+	{
+		bSuspendedBySignificance = false;
+		ResumeTracing();
+	}
+}
+
+bool UActorInteractorComponentTrace::GetUseAsyncTrace() const
+{ return bUseAsyncTrace; }
+
+void UActorInteractorComponentTrace::SetUseAsyncTrace(const bool bUse)
+{
+	if (bUseAsyncTrace == bUse) return;
+	
+	bUseAsyncTrace = bUse;
+	AsyncTraceHandle = FTraceHandle();
+}
+
+bool UActorInteractorComponentTrace::GetUseAdaptiveTraceInterval() const
+{ return bUseAdaptiveTraceInterval; }
+
+void UActorInteractorComponentTrace::SetUseAdaptiveTraceInterval(const bool bUse)
+{
+	bUseAdaptiveTraceInterval = bUse;
+	
+	EffectiveTraceInterval = TraceInterval;
+	bHasLastTraceViewpoint = false;
+}
+
+float UActorInteractorComponentTrace::GetEffectiveTraceInterval() const
+{ return FMath::Max3(0.01f, EffectiveTraceInterval, SignificanceTraceInterval); }
+
+float UActorInteractorComponentTrace::GetEffectiveTraceRate() const
+{ return 1.f / GetEffectiveTraceInterval(); }
+
 FTracingData UActorInteractorComponentTrace::GetLastTracingData() const
 { return LastTracingData; }
 
@@ -390,6 +893,27 @@ void UActorInteractorComponentTrace::SetState(const EInteractorStateV2 NewState)
 	}
 }
 
+void UActorInteractorComponentTrace::AddIgnoredActor(AActor* IgnoredActor)
+{
+	Super::AddIgnoredActor(IgnoredActor);
+
+	bCollisionParamsDirty = true;
+}
+
+void UActorInteractorComponentTrace::RemoveIgnoredActor(AActor* UnignoredActor)
+{
+	Super::RemoveIgnoredActor(UnignoredActor);
+
+	bCollisionParamsDirty = true;
+}
+
+void UActorInteractorComponentTrace::SetResponseChannel(const ECollisionChannel NewResponseChannel)
+{
+	Super::SetResponseChannel(NewResponseChannel);
+
+	bCollisionParamsDirty = true;
+}
+
 #if WITH_EDITOR
 
 void UActorInteractorComponentTrace::DrawTracingDebugStart(FInteractionTraceDataV2& InteractionTraceData) const
@@ -404,6 +928,15 @@ void UActorInteractorComponentTrace::DrawTracingDebugStart(FInteractionTraceData
 			case ETraceType::ETT_Loose:
 				DrawDebugSphere(GetWorld(), InteractionTraceData.StartLocation, 10.f, 6, FColor::Blue, false, TraceInterval, 0, 0.25f);
 				break;
+			case ETraceType::ETT_Spatial:
+				{
+					const FVector TraceDirection = (InteractionTraceData.EndLocation - InteractionTraceData.StartLocation).GetSafeNormal();
+					const float ConeAngle = FMath::DegreesToRadians(SpatialConeHalfAngle);
+					DrawDebugCone(GetWorld(), InteractionTraceData.StartLocation, TraceDirection, TraceRange, ConeAngle, ConeAngle, 12, FColor::Blue, false, TraceInterval, 0, 0.25f);
+				}
+				break;
+			case ETraceType::Default:
+			default: break;
 		}
 		
 		DrawDebugSphere(GetWorld(), InteractionTraceData.EndLocation, 10.f, 6, FColor::Red, false, TraceInterval, 0, 0.25f);
@@ -0,0 +1,50 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Helpers/ActorInteractableDefinition.h"
+
+#define LOCTEXT_NAMESPACE "ActorInteractableDefinition"
+
+UActorInteractableDefinition::UActorInteractableDefinition()
+{
+	InteractableName = LOCTEXT("ActorInteractableDefinition", "Default");
+	InteractionPeriod = 1.5f;
+	LifecycleMode = EInteractableLifecycle::EIL_Cycled;
+	LifecycleCount = -1;
+	CooldownPeriod = 3.f;
+}
+
+FPrimaryAssetId UActorInteractableDefinition::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(TEXT("InteractableDefinition"), GetFName());
+}
+
+#if WITH_EDITOR
+
+void UActorInteractableDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
+
+	// Same rules as Interactable setters, so Definition can never provide value Interactable would refuse
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UActorInteractableDefinition, LifecycleCount))
+	{
+		if (LifecycleCount == 0 || LifecycleCount == 1)
+		{
+			LifecycleCount = 2;
+		}
+	}
+
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UActorInteractableDefinition, InteractionPeriod))
+	{
+		if (InteractionPeriod > -1.f && InteractionPeriod < 0.1f)
+		{
+			InteractionPeriod = 0.1f;
+		}
+	}
+}
+
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -3,3 +3,46 @@
 
 #include "Helpers/ActorInteractionFunctionLibrary.h"
 
+UDataTable* UActorInteractionFunctionLibrary::GetInteractableDefaultDataTable()
+{
+	if (UDataTable* LoadedTable = GetLoadedInteractableDefaultDataTable())
+	{
+		return LoadedTable;
+	}
+
+	const UActorInteractionPluginSettings* Settings = GetMutableDefault<UActorInteractionPluginSettings>();
+
+	if (Settings)
+	{
+		// Only blocks when requested before async loading of Defaults has finished
+		if (const auto FoundTable = Settings->GetInteractableDefaultDataTable().LoadSynchronous())
+		{
+			if (FActorInteractionPluginModule::IsAvailable()) FActorInteractionPluginModule::Get().CacheDefaultDataTable(FoundTable);
+			return FoundTable;
+		}
+	}
+
+	AIntP_LOG(Error, TEXT("[GetInteractableDefaultDataTable] Cannot load ActorInteractionPluginSettings! Using null value."))
+	return nullptr;
+}
+
+TSubclassOf<UUserWidget> UActorInteractionFunctionLibrary::GetInteractableDefaultWidgetClass()
+{
+	if (const TSubclassOf<UUserWidget> LoadedClass = GetLoadedInteractableDefaultWidgetClass())
+	{
+		return LoadedClass;
+	}
+
+	const UActorInteractionPluginSettings* Settings = GetMutableDefault<UActorInteractionPluginSettings>();
+
+	if (Settings)
+	{
+		// Only blocks when requested before async loading of Defaults has finished
+		const TSubclassOf<UUserWidget> WidgetClass = Settings->GetInteractableDefaultWidgetClass().LoadSynchronous();
+		if (WidgetClass && FActorInteractionPluginModule::IsAvailable()) FActorInteractionPluginModule::Get().CacheDefaultWidgetClass(WidgetClass);
+		return WidgetClass;
+	}
+	
+	AIntP_LOG(Error, TEXT("[GetInteractableDefaultWidgetClass] Cannot load ActorInteractionPluginSettings! Using null value."))
+	return nullptr;
+}
@@ -0,0 +1,26 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Helpers/ActorInteractionPluginSettings.h"
+
+#include "ActorInteractionPlugin.h"
+
+#if WITH_EDITOR
+void UActorInteractionPluginSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
+	if
+	(
+		PropertyName == GET_MEMBER_NAME_CHECKED(UActorInteractionPluginSettings, InteractableDefaultWidgetClass) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(UActorInteractionPluginSettings, InteractableDefaultDataTable)
+	)
+	{
+		if (FActorInteractionPluginModule::IsAvailable())
+		{
+			FActorInteractionPluginModule::Get().ReloadDefaults();
+		}
+	}
+}
+#endif
@@ -0,0 +1,43 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Helpers/ActorInteractionWaitForDefaults.h"
+
+#include "ActorInteractionPlugin.h"
+
+UActorInteractionWaitForDefaults* UActorInteractionWaitForDefaults::WaitForInteractableDefaults(UObject* WorldContextObject)
+{
+	UActorInteractionWaitForDefaults* Action = NewObject<UActorInteractionWaitForDefaults>();
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UActorInteractionWaitForDefaults::Activate()
+{
+	if (!FActorInteractionPluginModule::IsAvailable())
+	{
+		SetReadyToDestroy();
+		return;
+	}
+
+	FActorInteractionPluginModule& Module = FActorInteractionPluginModule::Get();
+	if (Module.AreDefaultsLoaded())
+	{
+		HandleDefaultsLoaded();
+		return;
+	}
+
+	DefaultsLoadedHandle = Module.OnDefaultsLoaded().AddUObject(this, &UActorInteractionWaitForDefaults::HandleDefaultsLoaded);
+}
+
+void UActorInteractionWaitForDefaults::HandleDefaultsLoaded()
+{
+	if (DefaultsLoadedHandle.IsValid() && FActorInteractionPluginModule::IsAvailable())
+	{
+		FActorInteractionPluginModule::Get().OnDefaultsLoaded().Remove(DefaultsLoadedHandle);
+		DefaultsLoadedHandle.Reset();
+	}
+
+	OnLoaded.Broadcast();
+	SetReadyToDestroy();
+}
@@ -0,0 +1,108 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Helpers/InteractionCandidateScoring.h"
+
+#include "Interfaces/ActorInteractableInterface.h"
+#include "Helpers/ActorInteractionPluginStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Candidate Scoring"), STAT_InteractionCandidateScoring, STATGROUP_MounteaInteraction);
+
+void FInteractionCandidateSoA::Reset()
+{
+	Interactables.Reset();
+	SourceIndices.Reset();
+	Distances.Reset();
+	ViewDots.Reset();
+	Weights.Reset();
+	TimesSinceInteraction.Reset();
+	Scores.Reset();
+}
+
+int32 FInteractionCandidateSoA::Add(const TScriptInterface<IActorInteractableInterface>& Interactable, const int32 SourceIndex, const float Distance, const float ViewDot, const float TimeSinceInteraction)
+{
+	// Padding must not be interleaved with real candidates
+	const int32 NumCandidates = Num();
+	Distances.SetNum(NumCandidates, false);
+	ViewDots.SetNum(NumCandidates, false);
+	Weights.SetNum(NumCandidates, false);
+	TimesSinceInteraction.SetNum(NumCandidates, false);
+
+	Distances.Add(Distance);
+	ViewDots.Add(ViewDot);
+	Weights.Add(Interactable.GetInterface() ? static_cast<float>(Interactable->GetInteractableWeight()) : 0.f);
+	TimesSinceInteraction.Add(TimeSinceInteraction);
+	SourceIndices.Add(SourceIndex);
+
+	return Interactables.Add(Interactable);
+}
+
+void FInteractionCandidateSoA::Pad()
+{
+	const int32 NumToPad = Align(Num(), 4);
+
+	Distances.SetNumZeroed(NumToPad, false);
+	ViewDots.SetNumZeroed(NumToPad, false);
+	Weights.SetNumZeroed(NumToPad, false);
+	TimesSinceInteraction.SetNumZeroed(NumToPad, false);
+	Scores.SetNumZeroed(NumToPad, false);
+}
+
+int32 FInteractionCandidateSoA::FindBest() const
+{
+	int32 BestIndex = INDEX_NONE;
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		if (BestIndex == INDEX_NONE || Scores[i] > Scores[BestIndex])
+		{
+			BestIndex = i;
+		}
+	}
+
+	return BestIndex;
+}
+
+UInteractionScoringWeights::UInteractionScoringWeights()
+{
+	InteractableWeightFactor = 1.f;
+	ProximityFactor = 0.f;
+	ViewAlignmentFactor = 0.f;
+	FreshnessFactor = 0.f;
+	MaxDistance = 1000.f;
+	FreshnessPeriod = 10.f;
+}
+
+void UInteractionScoringWeights::ScoreCandidates(FInteractionCandidateSoA& Candidates) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionCandidateScoring);
+
+	checkSlow(Candidates.NumPadded() % 4 == 0);
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float WeightFactor = VectorSetFloat1(InteractableWeightFactor);
+	const VectorRegister4Float DistanceFactor = VectorSetFloat1(ProximityFactor);
+	const VectorRegister4Float ViewFactor = VectorSetFloat1(ViewAlignmentFactor);
+	const VectorRegister4Float TimeFactor = VectorSetFloat1(FreshnessFactor);
+	const VectorRegister4Float InvMaxDistance = VectorSetFloat1(1.f / FMath::Max(MaxDistance, 1.f));
+	const VectorRegister4Float InvFreshnessPeriod = VectorSetFloat1(1.f / FMath::Max(FreshnessPeriod, 0.01f));
+
+	const float* Distances = Candidates.Distances.GetData();
+	const float* ViewDots = Candidates.ViewDots.GetData();
+	const float* Weights = Candidates.Weights.GetData();
+	const float* TimesSinceInteraction = Candidates.TimesSinceInteraction.GetData();
+	float* Scores = Candidates.Scores.GetData();
+
+	for (int32 i = 0; i < Candidates.NumPadded(); i += 4)
+	{
+		const VectorRegister4Float Proximity = VectorSubtract(One, VectorMin(VectorMultiply(VectorLoad(Distances + i), InvMaxDistance), One));
+		const VectorRegister4Float Freshness = VectorMin(VectorMax(VectorMultiply(VectorLoad(TimesSinceInteraction + i), InvFreshnessPeriod), Zero), One);
+
+		VectorRegister4Float Score = VectorMultiply(VectorLoad(Weights + i), WeightFactor);
+		Score = VectorMultiplyAdd(Proximity, DistanceFactor, Score);
+		Score = VectorMultiplyAdd(VectorLoad(ViewDots + i), ViewFactor, Score);
+		Score = VectorMultiplyAdd(Freshness, TimeFactor, Score);
+
+		VectorStore(Score, Scores + i);
+	}
+}
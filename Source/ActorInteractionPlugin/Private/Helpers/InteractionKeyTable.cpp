@@ -0,0 +1,60 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Helpers/InteractionKeyTable.h"
+
+#include "Kismet/GameplayStatics.h"
+
+#include "Helpers/ActorInteractionPluginStats.h"
+#include "Helpers/InteractionHelpers.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interaction Key Sets"), STAT_InteractionKeySets, STATGROUP_MounteaInteraction);
+
+FInteractionKeyTable& FInteractionKeyTable::Get()
+{
+	static FInteractionKeyTable Instance;
+	return Instance;
+}
+
+FInteractionKeyTable::FInteractionKeyTable()
+{
+	RunningPlatformName = UGameplayStatics::GetPlatformName();
+	RunningPlatform = FName(*RunningPlatformName);
+
+	// Index 0 is shared by all Interactables without Keys for running platform
+	KeySets.AddDefaulted();
+	INC_DWORD_STAT(STAT_InteractionKeySets);
+}
+
+bool FInteractionKeyTable::IsRunningPlatform(const FString& PlatformName) const
+{
+	// Only existing Names are found, unknown platform names are never added to Name table
+	return FName(*PlatformName, FNAME_Find) == RunningPlatform;
+}
+
+int32 FInteractionKeyTable::FindOrAddKeySet(const TMap<FString, FInteractionKeySetup>& KeysPerPlatform)
+{
+	check(IsInGameThread());
+
+	const FInteractionKeySetup* KeySet = KeysPerPlatform.Find(RunningPlatformName);
+	if (KeySet == nullptr || KeySet->Keys.Num() == 0) return 0;
+
+	// There are only few distinct Key sets in any project, linear search is fine
+	for (int32 i = 0; i < KeySets.Num(); i++)
+	{
+		if (KeySets[i] == KeySet->Keys) return i;
+	}
+
+	INC_DWORD_STAT(STAT_InteractionKeySets);
+	return KeySets.Add(KeySet->Keys);
+}
+
+const TArray<FKey>& FInteractionKeyTable::GetKeys(const int32 KeySetIndex) const
+{
+	return KeySets.IsValidIndex(KeySetIndex) ? KeySets[KeySetIndex] : KeySets[0];
+}
+
+bool FInteractionKeyTable::ContainsKey(const int32 KeySetIndex, const FKey& Key) const
+{
+	return GetKeys(KeySetIndex).Contains(Key);
+}
@@ -0,0 +1,88 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Helpers/InteractionSignificanceProvider.h"
+
+#include "Components/ActorInteractorComponentTrace.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+UInteractionSignificanceProvider::UInteractionSignificanceProvider()
+{
+	TraceTiers.Add(FInteractionTraceTier(1500.f, 0.1f, false));
+	TraceTiers.Add(FInteractionTraceTier(4000.f, 0.5f, false));
+
+	OffScreenDistanceMultiplier = 2.f;
+	ViewHalfAngle = 60.f;
+}
+
+FInteractionSignificance UInteractionSignificanceProvider::EvaluateSignificance_Implementation(const UActorInteractorComponentTrace* Interactor) const
+{
+	FInteractionSignificance Result;
+
+	const AActor* InteractorOwner = Interactor ? Interactor->GetOwner() : nullptr;
+	if (InteractorOwner == nullptr) return Result;
+
+	const UWorld* World = InteractorOwner->GetWorld();
+	if (World == nullptr) return Result;
+
+	if (const APawn* OwnerPawn = Cast<APawn>(InteractorOwner))
+	{
+		Result.bPossessedByPlayer = OwnerPawn->IsPlayerControlled();
+	}
+
+	const FVector OwnerLocation = InteractorOwner->GetActorLocation();
+	const float CosViewHalfAngle = FMath::Cos(FMath::DegreesToRadians(ViewHalfAngle));
+
+	float NearestDistanceSquared = TNumericLimits<float>::Max();
+	bool bInAnyView = false;
+
+	for (FConstPlayerControllerIterator Itr = World->GetPlayerControllerIterator(); Itr; ++Itr)
+	{
+		const APlayerController* PlayerController = Itr->Get();
+		if (PlayerController == nullptr) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		const FVector ToOwner = OwnerLocation - ViewLocation;
+		const float DistanceSquared = ToOwner.SizeSquared();
+		NearestDistanceSquared = FMath::Min(NearestDistanceSquared, DistanceSquared);
+
+		if (!bInAnyView)
+		{
+			bInAnyView = (ToOwner | ViewRotation.Vector()) >= CosViewHalfAngle * FMath::Sqrt(DistanceSquared);
+		}
+	}
+
+	if (NearestDistanceSquared < TNumericLimits<float>::Max())
+	{
+		Result.DistanceToNearestView = FMath::Sqrt(NearestDistanceSquared);
+	}
+
+	Result.bOnScreen = bInAnyView || InteractorOwner->WasRecentlyRendered();
+
+	return Result;
+}
+
+FInteractionTraceTier UInteractionSignificanceProvider::SelectTraceTier_Implementation(const FInteractionSignificance& Significance) const
+{
+	// Players always trace at full rate
+	if (Significance.bPossessedByPlayer)
+	{
+		return FInteractionTraceTier();
+	}
+
+	const float Distance = Significance.bOnScreen ? Significance.DistanceToNearestView : Significance.DistanceToNearestView * OffScreenDistanceMultiplier;
+
+	for (const FInteractionTraceTier& Itr : TraceTiers)
+	{
+		if (Distance <= Itr.MaxDistance)
+		{
+			return Itr;
+		}
+	}
+
+	return FInteractionTraceTier(TNumericLimits<float>::Max(), 0.f, true);
+}
@@ -0,0 +1,274 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Subsystems/ActorInteractableRegistrySubsystem.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Interfaces/ActorInteractableInterface.h"
+#include "Components/ActorInteractableComponentBase.h"
+#include "Helpers/ActorInteractionPluginStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Collision Components"), STAT_InteractionRegisteredCollisions, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spatial Hash Interactables"), STAT_InteractionSpatialInteractables, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Spatial Hash Query"), STAT_InteractionSpatialQuery, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spatial Hash Updates (per frame)"), STAT_InteractionSpatialUpdates, STATGROUP_MounteaInteraction);
+
+void UActorInteractableRegistrySubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_InteractionRegisteredCollisions, CollisionToInteractables.Num());
+	DEC_DWORD_STAT_BY(STAT_InteractionSpatialInteractables, InteractableCells.Num());
+
+	CollisionToInteractables.Empty();
+	SpatialCells.Empty();
+	InteractableCells.Empty();
+
+	Super::Deinitialize();
+}
+
+void UActorInteractableRegistrySubsystem::RegisterCollisionComponent(const UPrimitiveComponent* CollisionComponent, const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	if (CollisionComponent == nullptr) return;
+	if (Interactable.GetObject() == nullptr) return;
+
+	FInteractableList* Interactables = CollisionToInteractables.Find(CollisionComponent);
+	if (Interactables == nullptr)
+	{
+		Interactables = &CollisionToInteractables.Add(CollisionComponent);
+		INC_DWORD_STAT(STAT_InteractionRegisteredCollisions);
+	}
+
+	Interactables->AddUnique(Interactable.GetObject());
+}
+
+void UActorInteractableRegistrySubsystem::UnregisterCollisionComponent(const UPrimitiveComponent* CollisionComponent, const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	if (CollisionComponent == nullptr) return;
+
+	FInteractableList* Interactables = CollisionToInteractables.Find(CollisionComponent);
+	if (Interactables == nullptr) return;
+
+	Interactables->RemoveSwap(Interactable.GetObject(), false);
+
+	if (Interactables->Num() == 0)
+	{
+		CollisionToInteractables.Remove(CollisionComponent);
+		DEC_DWORD_STAT(STAT_InteractionRegisteredCollisions);
+	}
+}
+
+void UActorInteractableRegistrySubsystem::UnregisterInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	if (Interactable.GetObject() == nullptr) return;
+
+	for (const auto& Itr : Interactable->GetCollisionComponents())
+	{
+		UnregisterCollisionComponent(Itr, Interactable);
+	}
+}
+
+void UActorInteractableRegistrySubsystem::RegisterSpatialInteractable(UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable == nullptr) return;
+
+	const FVector Location = Interactable->GetComponentLocation();
+	const FIntVector NewCell = GetCellCoordinates(Location);
+
+	if (FIntVector* OldCell = InteractableCells.Find(Interactable))
+	{
+		if (*OldCell == NewCell)
+		{
+			FInteractableSpatialCell& Cell = SpatialCells.FindChecked(NewCell);
+			for (FInteractableSpatialEntry& Itr : Cell)
+			{
+				if (Itr.Interactable.Get() == Interactable)
+				{
+					Itr.Location = Location;
+					return;
+				}
+			}
+		}
+
+		UnregisterSpatialInteractable(Interactable);
+	}
+
+	SpatialCells.FindOrAdd(NewCell).Emplace(Interactable, Location);
+	InteractableCells.Add(Interactable, NewCell);
+	INC_DWORD_STAT(STAT_InteractionSpatialInteractables);
+}
+
+void UActorInteractableRegistrySubsystem::UnregisterSpatialInteractable(const UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable == nullptr) return;
+
+	FIntVector CellCoordinates;
+	if (!InteractableCells.RemoveAndCopyValue(Interactable, CellCoordinates)) return;
+	DEC_DWORD_STAT(STAT_InteractionSpatialInteractables);
+
+	FInteractableSpatialCell* Cell = SpatialCells.Find(CellCoordinates);
+	if (Cell == nullptr) return;
+
+	Cell->RemoveAllSwap([Interactable](const FInteractableSpatialEntry& Entry)
+	{
+		return Entry.Interactable.Get() == Interactable || !Entry.Interactable.IsValid();
+	}, false);
+
+	if (Cell->Num() == 0)
+	{
+		SpatialCells.Remove(CellCoordinates);
+	}
+}
+
+void UActorInteractableRegistrySubsystem::UpdateSpatialInteractable(UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable == nullptr) return;
+
+	// Only Interactables already inserted are tracked, BeginPlay inserts them
+	if (!InteractableCells.Contains(Interactable)) return;
+
+	INC_DWORD_STAT(STAT_InteractionSpatialUpdates);
+
+	RegisterSpatialInteractable(Interactable);
+}
+
+FIntVector UActorInteractableRegistrySubsystem::GetCellCoordinates(const FVector& Location) const
+{
+	return FIntVector
+	(
+		FMath::FloorToInt(Location.X / SpatialCellSize),
+		FMath::FloorToInt(Location.Y / SpatialCellSize),
+		FMath::FloorToInt(Location.Z / SpatialCellSize)
+	);
+}
+
+template<typename PredicateType>
+void UActorInteractableRegistrySubsystem::ForEachCellInBox(const FVector& Min, const FVector& Max, PredicateType Predicate) const
+{
+	const FIntVector MinCell = GetCellCoordinates(Min);
+	const FIntVector MaxCell = GetCellCoordinates(Max);
+
+	const int64 NumCellsInBox =
+		static_cast<int64>(MaxCell.X - MinCell.X + 1) *
+		static_cast<int64>(MaxCell.Y - MinCell.Y + 1) *
+		static_cast<int64>(MaxCell.Z - MinCell.Z + 1);
+
+	// Large boxes in sparse levels are cheaper to resolve by visiting only occupied cells
+	if (NumCellsInBox > SpatialCells.Num())
+	{
+		for (const auto& Itr : SpatialCells)
+		{
+			const FIntVector& CellCoordinates = Itr.Key;
+			if (CellCoordinates.X < MinCell.X || CellCoordinates.X > MaxCell.X) continue;
+			if (CellCoordinates.Y < MinCell.Y || CellCoordinates.Y > MaxCell.Y) continue;
+			if (CellCoordinates.Z < MinCell.Z || CellCoordinates.Z > MaxCell.Z) continue;
+
+			Predicate(Itr.Value);
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				if (const FInteractableSpatialCell* Cell = SpatialCells.Find(FIntVector(X, Y, Z)))
+				{
+					Predicate(*Cell);
+				}
+			}
+		}
+	}
+}
+
+void UActorInteractableRegistrySubsystem::QueryRadius(const FVector& Origin, const float Radius, TArray<UActorInteractableComponentBase*>& OutInteractables) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionSpatialQuery);
+
+	const float RadiusSquared = FMath::Square(Radius);
+
+	ForEachCellInBox(Origin - FVector(Radius), Origin + FVector(Radius), [&](const FInteractableSpatialCell& Cell)
+	{
+		for (const FInteractableSpatialEntry& Itr : Cell)
+		{
+			if (FVector::DistSquared(Itr.Location, Origin) > RadiusSquared) continue;
+
+			if (UActorInteractableComponentBase* Interactable = Itr.Interactable.Get())
+			{
+				OutInteractables.Add(Interactable);
+			}
+		}
+	});
+}
+
+void UActorInteractableRegistrySubsystem::QueryBox(const FBox& Box, TArray<UActorInteractableComponentBase*>& OutInteractables) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionSpatialQuery);
+
+	if (!Box.IsValid) return;
+
+	ForEachCellInBox(Box.Min, Box.Max, [&](const FInteractableSpatialCell& Cell)
+	{
+		for (const FInteractableSpatialEntry& Itr : Cell)
+		{
+			if (!Box.IsInsideOrOn(Itr.Location)) continue;
+
+			if (UActorInteractableComponentBase* Interactable = Itr.Interactable.Get())
+			{
+				OutInteractables.Add(Interactable);
+			}
+		}
+	});
+}
+
+void UActorInteractableRegistrySubsystem::QueryCone(const FVector& Origin, const FVector& Direction, const float Range, const float HalfAngle, TArray<UActorInteractableComponentBase*>& OutInteractables) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionSpatialQuery);
+
+	const float RangeSquared = FMath::Square(Range);
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngle, 0.f, 180.f)));
+
+	ForEachCellInBox(Origin - FVector(Range), Origin + FVector(Range), [&](const FInteractableSpatialCell& Cell)
+	{
+		for (const FInteractableSpatialEntry& Itr : Cell)
+		{
+			const FVector ToEntry = Itr.Location - Origin;
+			const float DistanceSquared = ToEntry.SizeSquared();
+			if (DistanceSquared > RangeSquared) continue;
+
+			// Compares cosines without normalizing ToEntry
+			if (DistanceSquared > KINDA_SMALL_NUMBER && (ToEntry | Direction) < CosHalfAngle * FMath::Sqrt(DistanceSquared)) continue;
+
+			if (UActorInteractableComponentBase* Interactable = Itr.Interactable.Get())
+			{
+				OutInteractables.Add(Interactable);
+			}
+		}
+	});
+}
+
+TArray<UActorInteractableComponentBase*> UActorInteractableRegistrySubsystem::K2_QueryRadius(const FVector& Origin, const float Radius) const
+{
+	TArray<UActorInteractableComponentBase*> Result;
+	QueryRadius(Origin, FMath::Max(0.f, Radius), Result);
+	return Result;
+}
+
+TArray<UActorInteractableComponentBase*> UActorInteractableRegistrySubsystem::K2_QueryBox(const FVector& Center, const FVector& Extent) const
+{
+	TArray<UActorInteractableComponentBase*> Result;
+	QueryBox(FBox::BuildAABB(Center, Extent.GetAbs()), Result);
+	return Result;
+}
+
+TArray<UActorInteractableComponentBase*> UActorInteractableRegistrySubsystem::K2_QueryCone(const FVector& Origin, const FVector& Direction, const float Range, const float HalfAngle) const
+{
+	TArray<UActorInteractableComponentBase*> Result;
+	QueryCone(Origin, Direction.GetSafeNormal(), FMath::Max(0.f, Range), HalfAngle, Result);
+	return Result;
+}
+
+bool UActorInteractableRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
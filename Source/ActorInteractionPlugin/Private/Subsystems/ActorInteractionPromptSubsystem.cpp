@@ -0,0 +1,324 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Subsystems/ActorInteractionPromptSubsystem.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+#include "Components/ActorInteractableComponentBase.h"
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginStats.h"
+#include "Subsystems/ActorInteractableRegistrySubsystem.h"
+#include "Widgets/SInteractionPromptLayer.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Prompt Widgets"), STAT_InteractionPooledPromptWidgets, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Prompt Layer Update"), STAT_InteractionPromptLayerUpdate, STATGROUP_MounteaInteraction);
+
+namespace InteractionPromptSubsystem
+{
+	// Prompt Layer is painted above regular Player Screen Widgets
+	static constexpr int32 PromptLayerZOrder = 10;
+}
+
+void UActorInteractionPromptSubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_InteractionPooledPromptWidgets, PooledWidgets.Num());
+
+	for (const auto& Itr : PooledWidgets)
+	{
+		if (Itr.Value)
+		{
+			Itr.Value->RemoveFromParent();
+		}
+	}
+
+	PooledWidgets.Empty();
+	ActiveWidget = nullptr;
+	PromptInteractable.Reset();
+
+	if (PromptLayer.IsValid())
+	{
+		ULocalPlayer* LocalPlayer = GetLocalPlayer();
+		if (LocalPlayer && LocalPlayer->ViewportClient)
+		{
+			LocalPlayer->ViewportClient->RemoveViewportWidgetForPlayer(LocalPlayer, PromptLayer.ToSharedRef());
+		}
+		PromptLayer.Reset();
+	}
+	BatchedInteractables.Empty();
+	VisibleInteractables.Empty();
+
+	Super::Deinitialize();
+}
+
+void UActorInteractionPromptSubsystem::Tick(float DeltaTime)
+{
+	if (PromptLayer.IsValid())
+	{
+		UpdatePromptLayer();
+	}
+
+	if (ActiveWidget == nullptr) return;
+	
+	if (!PromptInteractable.IsValid())
+	{
+		HidePrompt(nullptr);
+		return;
+	}
+
+	UpdatePromptPosition();
+}
+
+ETickableTickType UActorInteractionPromptSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UActorInteractionPromptSubsystem::IsTickable() const
+{
+	return ActiveWidget != nullptr || BatchedInteractables.Num() > 0 || NearbyPromptRadius > 0.f;
+}
+
+TStatId UActorInteractionPromptSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UActorInteractionPromptSubsystem, STATGROUP_MounteaInteraction);
+}
+
+UWorld* UActorInteractionPromptSubsystem::GetTickableGameObjectWorld() const
+{
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	return LocalPlayer ? LocalPlayer->GetWorld() : nullptr;
+}
+
+void UActorInteractionPromptSubsystem::ShowPrompt(UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable == nullptr) return;
+
+	if (Interactable->GetPromptMode() == EInteractablePromptMode::EIPM_Batched)
+	{
+		AddBatchedPrompt(Interactable);
+		return;
+	}
+
+	UUserWidget* NewWidget = AcquireWidget(Interactable->GetWidgetClass());
+	if (NewWidget == nullptr)
+	{
+		AIntP_LOG(Warning, TEXT("[ShowPrompt] %s has no valid Widget Class!"), *Interactable->GetName())
+		return;
+	}
+
+	if (ActiveWidget && ActiveWidget != NewWidget)
+	{
+		ActiveWidget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	PromptInteractable = Interactable;
+	ActiveWidget = NewWidget;
+
+	RefreshPrompt(Interactable);
+	UpdatePromptPosition();
+
+	ActiveWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+void UActorInteractionPromptSubsystem::HidePrompt(const UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable != nullptr && Interactable->GetPromptMode() == EInteractablePromptMode::EIPM_Batched)
+	{
+		RemoveBatchedPrompt(Interactable);
+		return;
+	}
+	
+	// Null hides Prompt of Interactable which is no longer valid
+	if (Interactable != nullptr && PromptInteractable.Get() != Interactable) return;
+
+	if (ActiveWidget)
+	{
+		ActiveWidget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	ActiveWidget = nullptr;
+	PromptInteractable.Reset();
+}
+
+void UActorInteractionPromptSubsystem::RefreshPrompt(UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable == nullptr || PromptInteractable.Get() != Interactable) return;
+	if (ActiveWidget == nullptr) return;
+
+	Interactable->PushWidgetData(ActiveWidget);
+}
+
+UUserWidget* UActorInteractionPromptSubsystem::AcquireWidget(const TSubclassOf<UUserWidget>& WidgetClass)
+{
+	if (WidgetClass == nullptr) return nullptr;
+
+	if (UUserWidget* const* PooledWidget = PooledWidgets.Find(WidgetClass))
+	{
+		return *PooledWidget;
+	}
+
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	APlayerController* PlayerController = LocalPlayer ? LocalPlayer->GetPlayerController(LocalPlayer->GetWorld()) : nullptr;
+	if (PlayerController == nullptr) return nullptr;
+
+	UUserWidget* NewWidget = CreateWidget<UUserWidget>(PlayerController, WidgetClass);
+	if (NewWidget == nullptr) return nullptr;
+
+	NewWidget->SetVisibility(ESlateVisibility::Collapsed);
+	NewWidget->SetAlignmentInViewport(FVector2D(0.5f, 0.5f));
+	NewWidget->AddToPlayerScreen();
+
+	PooledWidgets.Add(WidgetClass, NewWidget);
+	INC_DWORD_STAT(STAT_InteractionPooledPromptWidgets);
+
+	return NewWidget;
+}
+
+void UActorInteractionPromptSubsystem::UpdatePromptPosition() const
+{
+	const UActorInteractableComponentBase* Interactable = PromptInteractable.Get();
+	if (Interactable == nullptr || ActiveWidget == nullptr) return;
+
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	const APlayerController* PlayerController = LocalPlayer ? LocalPlayer->GetPlayerController(LocalPlayer->GetWorld()) : nullptr;
+	if (PlayerController == nullptr) return;
+
+	FVector2D ScreenPosition;
+	if (UGameplayStatics::ProjectWorldToScreen(PlayerController, Interactable->GetComponentLocation(), ScreenPosition, true))
+	{
+		ActiveWidget->SetPositionInViewport(ScreenPosition, false);
+	}
+}
+
+TArray<UActorInteractableComponentBase*> UActorInteractionPromptSubsystem::GetBatchedInteractables() const
+{
+	TArray<UActorInteractableComponentBase*> ReturnValues;
+	ReturnValues.Reserve(BatchedInteractables.Num());
+	for (const auto& Itr : BatchedInteractables)
+	{
+		if (UActorInteractableComponentBase* Interactable = Itr.Get())
+		{
+			ReturnValues.Add(Interactable);
+		}
+	}
+
+	return ReturnValues;
+}
+
+void UActorInteractionPromptSubsystem::SetNearbyPromptRadius(const float NewRadius)
+{
+	NearbyPromptRadius = FMath::Max(0.f, NewRadius);
+
+	if (NearbyPromptRadius > 0.f)
+	{
+		EnsurePromptLayer();
+	}
+}
+
+void UActorInteractionPromptSubsystem::AddBatchedPrompt(UActorInteractableComponentBase* Interactable)
+{
+	if (Interactable == nullptr) return;
+
+	BatchedInteractables.AddUnique(Interactable);
+	EnsurePromptLayer();
+}
+
+void UActorInteractionPromptSubsystem::RemoveBatchedPrompt(const UActorInteractableComponentBase* Interactable)
+{
+	BatchedInteractables.RemoveAllSwap
+	(
+		[Interactable](const TWeakObjectPtr<UActorInteractableComponentBase>& Itr)
+		{
+			return !Itr.IsValid() || Itr.Get() == Interactable;
+		}
+	);
+}
+
+void UActorInteractionPromptSubsystem::EnsurePromptLayer()
+{
+	if (PromptLayer.IsValid()) return;
+
+	ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	if (LocalPlayer == nullptr || LocalPlayer->ViewportClient == nullptr)
+	{
+		AIntP_LOG(Warning, TEXT("[EnsurePromptLayer] Local Player has no Viewport, Batched Prompts will not be shown!"))
+		return;
+	}
+
+	PromptLayer = SNew(SInteractionPromptLayer);
+	LocalPlayer->ViewportClient->AddViewportWidgetForPlayer(LocalPlayer, PromptLayer.ToSharedRef(), InteractionPromptSubsystem::PromptLayerZOrder);
+}
+
+void UActorInteractionPromptSubsystem::UpdatePromptLayer()
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionPromptLayerUpdate);
+
+	TArray<FInteractionPromptRecord>& Records = PromptLayer->GetMutableRecords();
+	const bool bHadRecords = Records.Num() > 0;
+	Records.Reset();
+
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	const APlayerController* PlayerController = LocalPlayer ? LocalPlayer->GetPlayerController(LocalPlayer->GetWorld()) : nullptr;
+	if (PlayerController == nullptr)
+	{
+		if (bHadRecords) PromptLayer->MarkRecordsChanged();
+		return;
+	}
+
+	VisibleInteractables.Reset();
+	BatchedVisibleInteractables.Reset();
+	for (const auto& Itr : BatchedInteractables)
+	{
+		if (UActorInteractableComponentBase* Interactable = Itr.Get())
+		{
+			VisibleInteractables.Add(Interactable);
+			BatchedVisibleInteractables.Add(Interactable);
+		}
+	}
+
+	const APawn* PlayerPawn = PlayerController->GetPawn();
+	const UWorld* World = PlayerController->GetWorld();
+	if (NearbyPromptRadius > 0.f && PlayerPawn && World)
+	{
+		if (const UActorInteractableRegistrySubsystem* Registry = World->GetSubsystem<UActorInteractableRegistrySubsystem>())
+		{
+			const int32 FirstNearbyIndex = VisibleInteractables.Num();
+			Registry->QueryRadius(PlayerPawn->GetActorLocation(), NearbyPromptRadius, VisibleInteractables);
+
+			// Nearby Interactables only show their hint if they could be interacted with right now
+			for (int32 i = VisibleInteractables.Num() - 1; i >= FirstNearbyIndex; --i)
+			{
+				const UActorInteractableComponentBase* Interactable = VisibleInteractables[i];
+				if (Interactable->GetPromptMode() != EInteractablePromptMode::EIPM_Batched || !Interactable->CanBeTriggered() || BatchedVisibleInteractables.Contains(Interactable))
+				{
+					VisibleInteractables.RemoveAtSwap(i, 1, false);
+				}
+			}
+		}
+	}
+
+	Records.Reserve(VisibleInteractables.Num());
+	for (const UActorInteractableComponentBase* Itr : VisibleInteractables)
+	{
+		FVector2D ScreenPosition;
+		if (!UGameplayStatics::ProjectWorldToScreen(PlayerController, Itr->GetComponentLocation(), ScreenPosition, true)) continue;
+
+		FInteractionPromptRecord& NewRecord = Records.AddDefaulted_GetRef();
+		NewRecord.ScreenPosition = ScreenPosition;
+		const TArray<FKey>& Keys = Itr->GetRunningPlatformKeys();
+		NewRecord.KeyText = Keys.Num() > 0 ? Keys[0].GetDisplayName(false) : FText::GetEmpty();
+		NewRecord.NameText = Itr->GetInteractableName();
+		NewRecord.Progress = Itr->GetInteractionProgress();
+	}
+
+	if (bHadRecords || Records.Num() > 0)
+	{
+		PromptLayer->MarkRecordsChanged();
+	}
+}
@@ -0,0 +1,303 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Subsystems/ActorInteractionTimingSubsystem.h"
+
+#include "Helpers/ActorInteractionPluginStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Timing Wheel Tick"), STAT_InteractionTimingWheelTick, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interaction Timers"), STAT_InteractionTimers, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Timers Fired (per frame)"), STAT_InteractionTimersFired, STATGROUP_MounteaInteraction);
+
+/**
+ * Duration of one wheel slot in seconds.
+ * Timers fire at most one slot late, which is below one frame at 60 FPS.
+ */
+static constexpr double WheelResolution = 1.0 / 60.0;
+
+/**
+ * Amount of wheel slots, must be power of two.
+ * One revolution covers a bit over 4 seconds, longer Timers wait for multiple revolutions.
+ */
+static constexpr int32 WheelSlots = 256;
+static constexpr int32 WheelSlotMask = WheelSlots - 1;
+
+void UActorInteractionTimingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SlotHeads.Init(INDEX_NONE, WheelSlots);
+}
+
+void UActorInteractionTimingSubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_InteractionTimers, NumTimers);
+
+	Entries.Empty();
+	FreeEntries.Empty();
+	SlotHeads.Empty();
+	DueTimers.Empty();
+	NumTimers = 0;
+
+	Super::Deinitialize();
+}
+
+void UActorInteractionTimingSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionTimingWheelTick);
+
+	Super::Tick(DeltaTime);
+
+	WheelTime += DeltaTime;
+	StepAccumulator += DeltaTime;
+
+	while (StepAccumulator >= WheelResolution)
+	{
+		StepAccumulator -= WheelResolution;
+		AdvanceSlot();
+	}
+}
+
+TStatId UActorInteractionTimingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UActorInteractionTimingSubsystem, STATGROUP_MounteaInteraction);
+}
+
+void UActorInteractionTimingSubsystem::SetTimer(FInteractionTimerHandle& InOutHandle, const FSimpleDelegate& Delegate, const float Delay)
+{
+	ClearTimer(InOutHandle);
+
+	int32 EntryIndex;
+	if (FreeEntries.Num() > 0)
+	{
+		EntryIndex = FreeEntries.Pop(false);
+	}
+	else
+	{
+		EntryIndex = Entries.AddDefaulted();
+	}
+
+	FInteractionTimerEntry& Entry = Entries[EntryIndex];
+	Entry.Delegate = Delegate;
+	Entry.StartTime = WheelTime;
+	Entry.ExpirationTime = WheelTime + FMath::Max(0.f, Delay);
+	Entry.PausedRemaining = 0.0;
+	Entry.bActive = true;
+	Entry.bPaused = false;
+
+	LinkEntry(EntryIndex, Delay);
+
+	InOutHandle.Index = EntryIndex;
+	InOutHandle.Generation = Entry.Generation;
+
+	NumTimers++;
+	INC_DWORD_STAT(STAT_InteractionTimers);
+}
+
+void UActorInteractionTimingSubsystem::ClearTimer(FInteractionTimerHandle& InOutHandle)
+{
+	if (FindEntry(InOutHandle) != nullptr)
+	{
+		UnlinkEntry(InOutHandle.Index);
+		ReleaseEntry(InOutHandle.Index);
+	}
+
+	InOutHandle.Invalidate();
+}
+
+void UActorInteractionTimingSubsystem::ClearAllTimersForObject(const UObject* Object)
+{
+	if (Object == nullptr) return;
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		if (Entries[i].bActive && Entries[i].Delegate.IsBoundToObject(Object))
+		{
+			UnlinkEntry(i);
+			ReleaseEntry(i);
+		}
+	}
+}
+
+void UActorInteractionTimingSubsystem::PauseTimer(const FInteractionTimerHandle& Handle)
+{
+	FInteractionTimerEntry* Entry = FindEntry(Handle);
+	if (Entry == nullptr || Entry->bPaused) return;
+
+	UnlinkEntry(Handle.Index);
+
+	Entry->PausedRemaining = FMath::Max(0.0, Entry->ExpirationTime - WheelTime);
+	Entry->bPaused = true;
+}
+
+void UActorInteractionTimingSubsystem::UnPauseTimer(const FInteractionTimerHandle& Handle)
+{
+	FInteractionTimerEntry* Entry = FindEntry(Handle);
+	if (Entry == nullptr || !Entry->bPaused) return;
+
+	// Shift both timestamps, so Elapsed does not include time spent paused
+	const double Elapsed = (Entry->ExpirationTime - Entry->StartTime) - Entry->PausedRemaining;
+	Entry->StartTime = WheelTime - Elapsed;
+	Entry->ExpirationTime = WheelTime + Entry->PausedRemaining;
+	Entry->bPaused = false;
+
+	LinkEntry(Handle.Index, Entry->PausedRemaining);
+}
+
+bool UActorInteractionTimingSubsystem::IsTimerActive(const FInteractionTimerHandle& Handle) const
+{
+	const FInteractionTimerEntry* Entry = FindEntry(Handle);
+	return Entry != nullptr && !Entry->bPaused;
+}
+
+bool UActorInteractionTimingSubsystem::IsTimerPaused(const FInteractionTimerHandle& Handle) const
+{
+	const FInteractionTimerEntry* Entry = FindEntry(Handle);
+	return Entry != nullptr && Entry->bPaused;
+}
+
+float UActorInteractionTimingSubsystem::GetTimerElapsed(const FInteractionTimerHandle& Handle) const
+{
+	const FInteractionTimerEntry* Entry = FindEntry(Handle);
+	if (Entry == nullptr) return -1.f;
+
+	if (Entry->bPaused)
+	{
+		return static_cast<float>((Entry->ExpirationTime - Entry->StartTime) - Entry->PausedRemaining);
+	}
+
+	return static_cast<float>(WheelTime - Entry->StartTime);
+}
+
+float UActorInteractionTimingSubsystem::GetTimerRemaining(const FInteractionTimerHandle& Handle) const
+{
+	const FInteractionTimerEntry* Entry = FindEntry(Handle);
+	if (Entry == nullptr) return -1.f;
+
+	if (Entry->bPaused)
+	{
+		return static_cast<float>(Entry->PausedRemaining);
+	}
+
+	return static_cast<float>(FMath::Max(0.0, Entry->ExpirationTime - WheelTime));
+}
+
+bool UActorInteractionTimingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+const FInteractionTimerEntry* UActorInteractionTimingSubsystem::FindEntry(const FInteractionTimerHandle& Handle) const
+{
+	if (!Entries.IsValidIndex(Handle.Index)) return nullptr;
+
+	const FInteractionTimerEntry& Entry = Entries[Handle.Index];
+	return (Entry.bActive && Entry.Generation == Handle.Generation) ? &Entry : nullptr;
+}
+
+FInteractionTimerEntry* UActorInteractionTimingSubsystem::FindEntry(const FInteractionTimerHandle& Handle)
+{
+	return const_cast<FInteractionTimerEntry*>(static_cast<const UActorInteractionTimingSubsystem*>(this)->FindEntry(Handle));
+}
+
+void UActorInteractionTimingSubsystem::LinkEntry(const int32 EntryIndex, const double Delay)
+{
+	FInteractionTimerEntry& Entry = Entries[EntryIndex];
+
+	// Slot K ahead is processed in K * Resolution - Accumulator seconds
+	const int64 Steps = FMath::Max<int64>(1, FMath::CeilToInt64((FMath::Max(0.0, Delay) + StepAccumulator) / WheelResolution));
+
+	Entry.Slot = static_cast<int32>((CurrentSlot + Steps) & WheelSlotMask);
+	Entry.Rounds = static_cast<uint32>((Steps - 1) / WheelSlots);
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = SlotHeads[Entry.Slot];
+
+	if (Entry.Next != INDEX_NONE)
+	{
+		Entries[Entry.Next].Prev = EntryIndex;
+	}
+	SlotHeads[Entry.Slot] = EntryIndex;
+}
+
+void UActorInteractionTimingSubsystem::UnlinkEntry(const int32 EntryIndex)
+{
+	FInteractionTimerEntry& Entry = Entries[EntryIndex];
+	if (Entry.Slot == INDEX_NONE) return;
+
+	if (Entry.Prev != INDEX_NONE)
+	{
+		Entries[Entry.Prev].Next = Entry.Next;
+	}
+	else
+	{
+		SlotHeads[Entry.Slot] = Entry.Next;
+	}
+
+	if (Entry.Next != INDEX_NONE)
+	{
+		Entries[Entry.Next].Prev = Entry.Prev;
+	}
+
+	Entry.Slot = INDEX_NONE;
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = INDEX_NONE;
+}
+
+void UActorInteractionTimingSubsystem::ReleaseEntry(const int32 EntryIndex)
+{
+	FInteractionTimerEntry& Entry = Entries[EntryIndex];
+
+	Entry.Delegate.Unbind();
+	Entry.bActive = false;
+	Entry.bPaused = false;
+	Entry.Generation++;
+
+	FreeEntries.Add(EntryIndex);
+
+	NumTimers--;
+	DEC_DWORD_STAT(STAT_InteractionTimers);
+}
+
+void UActorInteractionTimingSubsystem::AdvanceSlot()
+{
+	CurrentSlot = (CurrentSlot + 1) & WheelSlotMask;
+
+	DueTimers.Reset();
+
+	int32 EntryIndex = SlotHeads[CurrentSlot];
+	while (EntryIndex != INDEX_NONE)
+	{
+		FInteractionTimerEntry& Entry = Entries[EntryIndex];
+		const int32 NextIndex = Entry.Next;
+
+		if (Entry.Rounds > 0)
+		{
+			Entry.Rounds--;
+		}
+		else
+		{
+			FInteractionTimerHandle& DueTimer = DueTimers.AddDefaulted_GetRef();
+			DueTimer.Index = EntryIndex;
+			DueTimer.Generation = Entry.Generation;
+
+			// Entry stays armed until its Delegate is executed, so earlier Delegates can still clear or pause it
+			UnlinkEntry(EntryIndex);
+		}
+
+		EntryIndex = NextIndex;
+	}
+
+	INC_DWORD_STAT_BY(STAT_InteractionTimersFired, DueTimers.Num());
+
+	// Delegates can arm or clear Timers, therefore they are executed once slot is processed
+	for (const FInteractionTimerHandle& Itr : DueTimers)
+	{
+		FInteractionTimerEntry* Entry = FindEntry(Itr);
+		if (Entry == nullptr || Entry->bPaused) continue;
+
+		const FSimpleDelegate Delegate = MoveTemp(Entry->Delegate);
+		ReleaseEntry(Itr.Index);
+		
+		Delegate.ExecuteIfBound();
+	}
+}
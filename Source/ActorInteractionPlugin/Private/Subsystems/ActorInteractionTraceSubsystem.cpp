@@ -0,0 +1,403 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Subsystems/ActorInteractionTraceSubsystem.h"
+
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginStats.h"
+
+#include "Algo/Sort.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trace Scheduler Tick"), STAT_InteractionTraceSchedulerTick, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Trace Scheduler Gather"), STAT_InteractionTraceSchedulerGather, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Trace Scheduler Issue"), STAT_InteractionTraceSchedulerIssue, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Trace Scheduler Dispatch"), STAT_InteractionTraceSchedulerDispatch, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trace Queries (per frame)"), STAT_InteractionTraceQueries, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Trace Interactors"), STAT_InteractionTraceInteractors, STATGROUP_MounteaInteraction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Effective Trace Rate (traces/s)"), STAT_InteractionEffectiveTraceRate, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Trace Interactors Suspended by Significance"), STAT_InteractionTraceSuspended, STATGROUP_MounteaInteraction);
+DECLARE_CYCLE_STAT(TEXT("Trace Significance Update"), STAT_InteractionTraceSignificance, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trace Queries Deferred (per frame)"), STAT_InteractionTraceQueriesDeferred, STATGROUP_MounteaInteraction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Trace Queries Variance"), STAT_InteractionTraceQueriesVariance, STATGROUP_MounteaInteraction);
+
+TRACE_DECLARE_INT_COUNTER(MounteaInteraction_TraceQueries, TEXT("MounteaInteraction/TraceQueries"));
+TRACE_DECLARE_FLOAT_COUNTER(MounteaInteraction_TraceQueriesVariance, TEXT("MounteaInteraction/TraceQueriesVariance"));
+
+static TAutoConsoleVariable<int32> CVarTraceBudgetPerFrame
+(
+	TEXT("Mountea.Interaction.TraceBudgetPerFrame"),
+	0,
+	TEXT("Maximum number of Interaction trace queries issued per frame. Most overdue Interactors are served first.\n")
+	TEXT("0: unlimited (default)"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarSignificanceUpdateInterval
+(
+	TEXT("Mountea.Interaction.SignificanceUpdateInterval"),
+	0.25f,
+	TEXT("Interval in seconds at which Significance Providers of Trace Interactors are evaluated."),
+	ECVF_Default
+);
+
+/**
+ * Weight of current frame in running mean and variance of per-frame trace queries.
+ * Roughly last 30 frames are taken into account.
+ */
+static constexpr float TraceQueriesSmoothing = 1.f / 30.f;
+
+/**
+ * Golden ratio conjugate. Consecutive multiples modulo 1 are spread evenly over <0, 1).
+ */
+static constexpr double PhaseOffsetStep = 0.6180339887498949;
+
+LLM_DEFINE_TAG(MounteaInteraction_Trace);
+
+UActorInteractionTraceSubsystem::UActorInteractionTraceSubsystem() :
+bProcessingFrame(false),
+bHasStaleSchedules(false)
+{
+}
+
+void UActorInteractionTraceSubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_InteractionTraceInteractors, Schedules.Num());
+
+	Schedules.Empty();
+	ScheduleIndices.Empty();
+	ActiveSchedules.Empty();
+	PendingRequests.Empty();
+	DueSchedules.Empty();
+
+	Super::Deinitialize();
+}
+
+void UActorInteractionTraceSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSchedulerTick);
+	LLM_SCOPE_BYTAG(MounteaInteraction_Trace);
+
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	if (!World) return;
+
+	const double Now = World->GetTimeSeconds();
+
+	bProcessingFrame = true;
+	PendingRequests.Reset();
+
+	// Apply trace-rate tiers, including Interactors currently suspended
+	if (Now >= NextSignificanceUpdateTime)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSignificance);
+		
+		NextSignificanceUpdateTime = Now + FMath::Max(0.f, CVarSignificanceUpdateInterval.GetValueOnGameThread());
+
+		int32 NumSuspended = 0;
+		// Suspended Interactors are only visited here, so they can resume
+		for (int32 Index = 0; Index < Schedules.Num(); ++Index)
+		{
+			if (UActorInteractorComponentTrace* Interactor = Schedules[Index].Interactor.Get())
+			{
+				Interactor->UpdateSignificance();
+				NumSuspended += Interactor->IsSuspendedBySignificance() ? 1 : 0;
+			}
+			else
+			{
+				bHasStaleSchedules = true;
+			}
+		}
+
+		SET_DWORD_STAT(STAT_InteractionTraceSuspended, NumSuspended);
+	}
+
+	// Gather query descriptors from all Interactors which are due
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSchedulerGather);
+
+		float EffectiveTraceRate = 0.f;
+		DueSchedules.Reset();
+		
+		for (const int32 Index : ActiveSchedules)
+		{
+			const FInteractionTraceSchedule& Itr = Schedules[Index];
+
+			const UActorInteractorComponentTrace* Interactor = Itr.Interactor.Get();
+			if (Interactor == nullptr)
+			{
+				bHasStaleSchedules = true;
+				continue;
+			}
+
+			EffectiveTraceRate += Interactor->GetEffectiveTraceRate();
+			
+			if (Itr.NextTraceTime > Now && !Interactor->ShouldTraceEarly()) continue;
+
+			// Async trace submitted earlier is still waiting for its results
+			if (Interactor->IsAsyncTracePending()) continue;
+
+			DueSchedules.Add(Index);
+		}
+
+		SET_FLOAT_STAT(STAT_InteractionEffectiveTraceRate, EffectiveTraceRate);
+
+		// Over budget, serve most overdue Interactors and let the rest wait for next frame
+		const int32 TraceBudget = CVarTraceBudgetPerFrame.GetValueOnGameThread();
+		if (TraceBudget > 0 && DueSchedules.Num() > TraceBudget)
+		{
+			INC_DWORD_STAT_BY(STAT_InteractionTraceQueriesDeferred, DueSchedules.Num() - TraceBudget);
+			
+			Algo::Sort(DueSchedules, [this](const int32 A, const int32 B)
+			{
+				return Schedules[A].NextTraceTime < Schedules[B].NextTraceTime;
+			});
+			DueSchedules.SetNum(TraceBudget, false);
+		}
+
+		for (const int32 Index : DueSchedules)
+		{
+			FInteractionTraceSchedule& Itr = Schedules[Index];
+			
+			UActorInteractorComponentTrace* Interactor = Itr.Interactor.Get();
+			if (Interactor == nullptr) continue;
+			
+			if (Interactor->PrepareTrace(Interactor->TraceBuffer))
+			{
+				PendingRequests.Emplace(Interactor, Index);
+			}
+
+			Itr.NextTraceTime = Now + Interactor->GetEffectiveTraceInterval();
+		}
+	}
+
+	// Issue all gathered queries in one go
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSchedulerIssue);
+
+		for (FInteractionTraceRequest& Itr : PendingRequests)
+		{
+			if (UActorInteractorComponentTrace* Interactor = GetRequestInteractor(Itr))
+			{
+				Itr.bResultsReady = Interactor->ExecuteTrace(Interactor->TraceBuffer);
+			}
+		}
+	}
+
+	// Dispatch results back to Interactors
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTraceSchedulerDispatch);
+
+		for (FInteractionTraceRequest& Itr : PendingRequests)
+		{
+			// Async results are dispatched by World on next frame
+			if (!Itr.bResultsReady) continue;
+			
+			// Results of Interactors disabled by earlier dispatches are dropped
+			if (UActorInteractorComponentTrace* Interactor = GetRequestInteractor(Itr))
+			{
+				Interactor->ResolveTrace(Interactor->TraceBuffer);
+			}
+		}
+	}
+
+	NumQueriesLastFrame = PendingRequests.Num();
+	INC_DWORD_STAT_BY(STAT_InteractionTraceQueries, NumQueriesLastFrame);
+
+	// Exponentially weighted mean and variance, spikes caused by Interactors tracing in lockstep show up as high variance
+	{
+		const float Delta = NumQueriesLastFrame - TraceQueriesMean;
+		TraceQueriesMean += TraceQueriesSmoothing * Delta;
+		TraceQueriesVariance = (1.f - TraceQueriesSmoothing) * (TraceQueriesVariance + TraceQueriesSmoothing * Delta * Delta);
+	}
+	
+	SET_FLOAT_STAT(STAT_InteractionTraceQueriesVariance, TraceQueriesVariance);
+	TRACE_COUNTER_SET(MounteaInteraction_TraceQueries, NumQueriesLastFrame);
+	TRACE_COUNTER_SET(MounteaInteraction_TraceQueriesVariance, TraceQueriesVariance);
+
+	bProcessingFrame = false;
+
+	RemoveStaleSchedules();
+}
+
+bool UActorInteractionTraceSubsystem::IsTickable() const
+{
+	return Schedules.Num() > 0;
+}
+
+TStatId UActorInteractionTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UActorInteractionTraceSubsystem, STATGROUP_MounteaInteraction);
+}
+
+void UActorInteractionTraceSubsystem::RegisterInteractor(UActorInteractorComponentTrace* Interactor)
+{
+	if (Interactor == nullptr) return;
+
+	if (FindSchedule(Interactor) != nullptr)
+	{
+		SetInteractorPaused(Interactor, false);
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// Interactors registered in the same frame get different phase within their interval, so they do not trace in lockstep
+	const double Phase = FMath::Frac(PhaseOffsetStep * NumPhaseOffsets++);
+
+	const int32 Index = Schedules.Emplace(Interactor, Now + Interactor->GetEffectiveTraceInterval() * Phase);
+	ScheduleIndices.Add(Interactor, Index);
+	AddActiveSchedule(Index);
+	INC_DWORD_STAT(STAT_InteractionTraceInteractors);
+}
+
+void UActorInteractionTraceSubsystem::UnregisterInteractor(const UActorInteractorComponentTrace* Interactor)
+{
+	if (Interactor == nullptr) return;
+
+	int32 Index = INDEX_NONE;
+	if (!ScheduleIndices.RemoveAndCopyValue(Interactor, Index)) return;
+
+	if (bProcessingFrame)
+	{
+		// Requests gathered this frame keep Schedule index, so Schedule is only removed once frame is finished
+		RemoveActiveSchedule(Index);
+		Schedules[Index].Interactor.Reset();
+		bHasStaleSchedules = true;
+		return;
+	}
+
+	RemoveScheduleAt(Index);
+}
+
+void UActorInteractionTraceSubsystem::SetInteractorPaused(const UActorInteractorComponentTrace* Interactor, const bool bPaused)
+{
+	const int32* Index = ScheduleIndices.Find(Interactor);
+	if (Index == nullptr) return;
+
+	FInteractionTraceSchedule& Schedule = Schedules[*Index];
+	if (Schedule.bPaused == bPaused) return;
+
+	Schedule.bPaused = bPaused;
+	if (bPaused)
+	{
+		RemoveActiveSchedule(*Index);
+	}
+	else
+	{
+		AddActiveSchedule(*Index);
+	}
+}
+
+bool UActorInteractionTraceSubsystem::IsInteractorTracing(const UActorInteractorComponentTrace* Interactor) const
+{
+	const FInteractionTraceSchedule* Schedule = FindSchedule(Interactor);
+	return Schedule != nullptr && !Schedule->bPaused;
+}
+
+bool UActorInteractionTraceSubsystem::IsInteractorPaused(const UActorInteractorComponentTrace* Interactor) const
+{
+	const FInteractionTraceSchedule* Schedule = FindSchedule(Interactor);
+	return Schedule != nullptr && Schedule->bPaused;
+}
+
+UActorInteractorComponentTrace* UActorInteractionTraceSubsystem::GetRequestInteractor(const FInteractionTraceRequest& Request) const
+{
+	// Schedules are only removed once frame is finished, so index stays valid
+	if (!Schedules.IsValidIndex(Request.ScheduleIndex)) return nullptr;
+
+	const FInteractionTraceSchedule& Schedule = Schedules[Request.ScheduleIndex];
+	if (Schedule.bPaused) return nullptr;
+
+	UActorInteractorComponentTrace* Interactor = Schedule.Interactor.Get();
+	if (Interactor == nullptr || Interactor != Request.Interactor.Get() || !Interactor->CanTrace()) return nullptr;
+
+	return Interactor;
+}
+
+bool UActorInteractionTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FInteractionTraceSchedule* UActorInteractionTraceSubsystem::FindSchedule(const UActorInteractorComponentTrace* Interactor)
+{
+	const int32* Index = ScheduleIndices.Find(Interactor);
+	return Index ? &Schedules[*Index] : nullptr;
+}
+
+const FInteractionTraceSchedule* UActorInteractionTraceSubsystem::FindSchedule(const UActorInteractorComponentTrace* Interactor) const
+{
+	const int32* Index = ScheduleIndices.Find(Interactor);
+	return Index ? &Schedules[*Index] : nullptr;
+}
+
+void UActorInteractionTraceSubsystem::AddActiveSchedule(const int32 ScheduleIndex)
+{
+	FInteractionTraceSchedule& Schedule = Schedules[ScheduleIndex];
+	if (Schedule.ActiveIndex != INDEX_NONE) return;
+
+	Schedule.ActiveIndex = ActiveSchedules.Add(ScheduleIndex);
+}
+
+void UActorInteractionTraceSubsystem::RemoveActiveSchedule(const int32 ScheduleIndex)
+{
+	FInteractionTraceSchedule& Schedule = Schedules[ScheduleIndex];
+	const int32 ActiveIndex = Schedule.ActiveIndex;
+	if (ActiveIndex == INDEX_NONE) return;
+
+	ActiveSchedules.RemoveAtSwap(ActiveIndex, 1, false);
+	if (ActiveSchedules.IsValidIndex(ActiveIndex))
+	{
+		Schedules[ActiveSchedules[ActiveIndex]].ActiveIndex = ActiveIndex;
+	}
+	Schedule.ActiveIndex = INDEX_NONE;
+}
+
+void UActorInteractionTraceSubsystem::RemoveScheduleAt(const int32 ScheduleIndex)
+{
+	RemoveActiveSchedule(ScheduleIndex);
+
+	// Interactor might have been registered again meanwhile, its new Schedule stays indexed
+	const TObjectKey<UActorInteractorComponentTrace> InteractorKey = Schedules[ScheduleIndex].InteractorKey;
+	const int32* RemovedIndex = ScheduleIndices.Find(InteractorKey);
+	if (RemovedIndex && *RemovedIndex == ScheduleIndex)
+	{
+		ScheduleIndices.Remove(InteractorKey);
+	}
+
+	Schedules.RemoveAtSwap(ScheduleIndex, 1, false);
+	DEC_DWORD_STAT(STAT_InteractionTraceInteractors);
+
+	if (!Schedules.IsValidIndex(ScheduleIndex)) return;
+
+	// Last Schedule has been moved into removed one
+	const FInteractionTraceSchedule& Moved = Schedules[ScheduleIndex];
+	int32* MovedIndex = ScheduleIndices.Find(Moved.InteractorKey);
+	if (MovedIndex && *MovedIndex == Schedules.Num())
+	{
+		*MovedIndex = ScheduleIndex;
+	}
+	if (Moved.ActiveIndex != INDEX_NONE)
+	{
+		ActiveSchedules[Moved.ActiveIndex] = ScheduleIndex;
+	}
+}
+
+void UActorInteractionTraceSubsystem::RemoveStaleSchedules()
+{
+	if (!bHasStaleSchedules) return;
+	bHasStaleSchedules = false;
+
+	// Backwards, so Schedules moved into removed ones were already checked
+	for (int32 Index = Schedules.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Schedules[Index].Interactor.IsValid())
+		{
+			RemoveScheduleAt(Index);
+		}
+	}
+}
@@ -113,9 +113,21 @@ void UActorInteractableWidget::SetInteractionProgress(const float NewInteraction
 	OnInteractionProgressChanged(InteractionProgress);
 }
 
+void UActorInteractableWidget::SetInteractionProgressTiming(const float Timestamp, const float Progress, const float NewProgressRate)
+{
+	ProgressTimestamp = Timestamp;
+	ProgressAtTimestamp = Progress;
+	ProgressRate = NewProgressRate;
+
+	SetInteractionProgress(Progress);
+}
+
 void UActorInteractableWidget::NativeTick(const FGeometry& MyGeometry, const float InDeltaTime)
 {
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
-	CalculateRemainingTime(InDeltaTime);
+	// Progress is pushed by Interactable whenever its timing changes, idle Widget does no work
+	if (ProgressRate == 0.f || GetWorld() == nullptr) return;
+
+	SetInteractionProgress(FMath::Clamp(ProgressAtTimestamp + (GetWorld()->GetTimeSeconds() - ProgressTimestamp) * ProgressRate, 0.f, 1.f));
 }
\ No newline at end of file
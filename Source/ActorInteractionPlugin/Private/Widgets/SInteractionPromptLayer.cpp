@@ -0,0 +1,147 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+
+#include "Widgets/SInteractionPromptLayer.h"
+
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+#include "Helpers/ActorInteractionPluginStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Prompt Layer Paint"), STAT_InteractionPromptLayerPaint, STATGROUP_MounteaInteraction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Prompts (per frame)"), STAT_InteractionBatchedPrompts, STATGROUP_MounteaInteraction);
+
+namespace InteractionPromptLayer
+{
+	static const FVector2D KeySize(32.f, 32.f);
+	static constexpr float NamePadding = 8.f;
+	static constexpr float RingRadius = 21.f;
+	static constexpr float RingThickness = 3.f;
+	static constexpr int32 RingSegments = 32;
+
+	static const FLinearColor KeyBackgroundColor(0.f, 0.f, 0.f, 0.6f);
+	static const FLinearColor KeyColor = FLinearColor::White;
+	static const FLinearColor NameColor = FLinearColor::White;
+	static const FLinearColor RingColor(1.f, 0.8f, 0.2f, 1.f);
+}
+
+void SInteractionPromptLayer::Construct(const FArguments& InArgs)
+{
+	KeyFont = FCoreStyle::GetDefaultFontStyle("Bold", 14);
+	NameFont = FCoreStyle::GetDefaultFontStyle("Regular", 12);
+	KeyBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+
+	SetVisibility(EVisibility::HitTestInvisible);
+	SetCanTick(false);
+}
+
+int32 SInteractionPromptLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionPromptLayerPaint);
+	INC_DWORD_STAT_BY(STAT_InteractionBatchedPrompts, Records.Num());
+
+	if (Records.Num() == 0) return LayerId;
+
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const float InverseScale = AllottedGeometry.Scale > 0.f ? 1.f / AllottedGeometry.Scale : 1.f;
+
+	const int32 BackgroundLayer = LayerId;
+	const int32 ForegroundLayer = LayerId + 1;
+
+	for (const FInteractionPromptRecord& Itr : Records)
+	{
+		const FVector2D Center = Itr.ScreenPosition * InverseScale;
+		const FVector2D KeyTopLeft = Center - InteractionPromptLayer::KeySize * 0.5f;
+
+		// Key glyph
+		FSlateDrawElement::MakeBox
+		(
+			OutDrawElements,
+			BackgroundLayer,
+			AllottedGeometry.ToPaintGeometry(InteractionPromptLayer::KeySize, FSlateLayoutTransform(KeyTopLeft)),
+			KeyBrush,
+			ESlateDrawEffect::None,
+			InteractionPromptLayer::KeyBackgroundColor
+		);
+
+		if (!Itr.KeyText.IsEmpty())
+		{
+			const FVector2D KeyTextSize = FontMeasure->Measure(Itr.KeyText, KeyFont);
+			FSlateDrawElement::MakeText
+			(
+				OutDrawElements,
+				ForegroundLayer,
+				AllottedGeometry.ToPaintGeometry(KeyTextSize, FSlateLayoutTransform(Center - KeyTextSize * 0.5f)),
+				Itr.KeyText,
+				KeyFont,
+				ESlateDrawEffect::None,
+				InteractionPromptLayer::KeyColor
+			);
+		}
+
+		// Interactable Name
+		if (!Itr.NameText.IsEmpty())
+		{
+			const FVector2D NameSize = FontMeasure->Measure(Itr.NameText, NameFont);
+			const FVector2D NameTopLeft(KeyTopLeft.X + InteractionPromptLayer::KeySize.X + InteractionPromptLayer::NamePadding, Center.Y - NameSize.Y * 0.5f);
+			FSlateDrawElement::MakeText
+			(
+				OutDrawElements,
+				ForegroundLayer,
+				AllottedGeometry.ToPaintGeometry(NameSize, FSlateLayoutTransform(NameTopLeft)),
+				Itr.NameText,
+				NameFont,
+				ESlateDrawEffect::None,
+				InteractionPromptLayer::NameColor
+			);
+		}
+
+		// Progress ring
+		if (Itr.Progress > 0.f)
+		{
+			PaintProgressRing(AllottedGeometry, OutDrawElements, ForegroundLayer, Center, Itr.Progress);
+		}
+	}
+
+	return ForegroundLayer;
+}
+
+FVector2D SInteractionPromptLayer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// Layer always covers whole viewport it is added to
+	return FVector2D::ZeroVector;
+}
+
+void SInteractionPromptLayer::MarkRecordsChanged()
+{
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SInteractionPromptLayer::PaintProgressRing(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FVector2D& Center, const float Progress) const
+{
+	const float ClampedProgress = FMath::Clamp(Progress, 0.f, 1.f);
+	const int32 NumSegments = FMath::Max(1, FMath::CeilToInt(InteractionPromptLayer::RingSegments * ClampedProgress));
+	const float SweepAngle = 2.f * PI * ClampedProgress;
+
+	RingPoints.Reset(NumSegments + 1);
+	for (int32 i = 0; i <= NumSegments; ++i)
+	{
+		// Ring starts at the top and goes clockwise
+		const float Angle = -HALF_PI + SweepAngle * (static_cast<float>(i) / NumSegments);
+		RingPoints.Add(Center + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * InteractionPromptLayer::RingRadius);
+	}
+
+	FSlateDrawElement::MakeLines
+	(
+		OutDrawElements,
+		LayerId,
+		AllottedGeometry.ToPaintGeometry(),
+		RingPoints,
+		ESlateDrawEffect::None,
+		InteractionPromptLayer::RingColor,
+		true,
+		InteractionPromptLayer::RingThickness
+	);
+}
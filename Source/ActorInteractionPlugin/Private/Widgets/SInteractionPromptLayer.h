@@ -0,0 +1,70 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+/**
+ * One Prompt painted by Interaction Prompt Layer.
+ */
+struct FInteractionPromptRecord
+{
+	// Position in Player viewport, in pixels
+	FVector2D ScreenPosition = FVector2D::ZeroVector;
+
+	FText KeyText;
+	FText NameText;
+
+	// Progress between 0 and 1, ring is not painted while 0
+	float Progress = 0.f;
+};
+
+/**
+ * Interaction Prompt Layer
+ *
+ * Leaf Slate Widget covering Player viewport, which paints all visible Prompts in single OnPaint pass.
+ * Each Prompt consists of Key glyph, Interactable Name and progress ring.
+ *
+ * Used by Prompt Subsystem for Interactables with Batched Prompt Mode, so showing Prompts for dozens of Interactables
+ * does not create dozens of User Widgets.
+ */
+class SInteractionPromptLayer : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SInteractionPromptLayer)
+	{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+	/**
+	 * Returns Prompt Records to be filled for next paint.
+	 */
+	TArray<FInteractionPromptRecord>& GetMutableRecords()
+	{ return Records; };
+
+	/**
+	 * Requests repaint once Records were changed.
+	 */
+	void MarkRecordsChanged();
+
+private:
+
+	void PaintProgressRing(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FVector2D& Center, const float Progress) const;
+
+private:
+
+	TArray<FInteractionPromptRecord> Records;
+
+	// Points of progress ring, reused between paints
+	mutable TArray<FVector2D> RingPoints;
+
+	FSlateFontInfo KeyFont;
+	FSlateFontInfo NameFont;
+	const FSlateBrush* KeyBrush = nullptr;
+};
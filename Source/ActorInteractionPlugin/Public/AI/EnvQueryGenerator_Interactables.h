@@ -0,0 +1,75 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataProviders/AIDataProvider.h"
+#include "EnvironmentQuery/EnvQueryGenerator.h"
+#include "EnvQueryGenerator_Interactables.generated.h"
+
+class UActorInteractableComponentBase;
+
+/**
+ * Interactables EQS Generator
+ *
+ * Generates Owners of Interactables around Search Center.
+ * Candidates are taken from Spatial Hash of Interactable Registry, so cost scales with amount of nearby Interactables
+ * instead of amount of Actors in World.
+ */
+UCLASS(meta=(DisplayName = "Interactables"))
+class ACTORINTERACTIONPLUGIN_API UEnvQueryGenerator_Interactables : public UEnvQueryGenerator
+{
+	GENERATED_BODY()
+
+public:
+
+	UEnvQueryGenerator_Interactables(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void GenerateItems(FEnvQueryInstance& QueryInstance) const override;
+
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+
+protected:
+
+	/**
+	 * Returns whether Interactable passes all filters of this Generator.
+	 */
+	virtual bool PassesFilters(const UActorInteractableComponentBase* Interactable) const;
+
+protected:
+
+	/**
+	 * Radius around Search Center in which Interactables are searched.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Generator")
+	FAIDataProviderFloatValue SearchRadius;
+
+	/**
+	 * Context around which Interactables are searched.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Generator")
+	TSubclassOf<UEnvQueryContext> SearchCenter;
+
+	/**
+	 * If True, only Interactables which can be triggered right now are generated.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Generator")
+	uint8 bOnlyTriggerable : 1;
+
+	UPROPERTY(EditDefaultsOnly, Category="Generator", meta=(InlineEditConditionToggle))
+	uint8 bFilterByCollisionChannel : 1;
+	/**
+	 * Only Interactables using this Collision Channel are generated.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Generator", meta=(EditCondition="bFilterByCollisionChannel"))
+	TEnumAsByte<ECollisionChannel> CollisionChannel;
+
+	UPROPERTY(EditDefaultsOnly, Category="Generator", meta=(InlineEditConditionToggle))
+	uint8 bFilterByWeight : 1;
+	/**
+	 * Only Interactables with at least this Weight are generated.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Generator", meta=(EditCondition="bFilterByWeight"))
+	int32 MinimumWeight;
+};
@@ -0,0 +1,29 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "EnvQueryTest_InteractableWeight.generated.h"
+
+/**
+ * Interactable Weight EQS Test
+ *
+ * Scores Actors by Weight of their Interactables.
+ * If Actor owns multiple Interactables, highest Weight is used.
+ * Actors without any Interactable fail this Test.
+ */
+UCLASS(meta=(DisplayName = "Interactable Weight"))
+class ACTORINTERACTIONPLUGIN_API UEnvQueryTest_InteractableWeight : public UEnvQueryTest
+{
+	GENERATED_BODY()
+
+public:
+
+	UEnvQueryTest_InteractableWeight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+};
@@ -3,8 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
 #include "Modules/ModuleManager.h"
 #include "Styling/SlateStyle.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UDataTable;
+class UUserWidget;
 
 class FActorInteractionPluginModule : public IModuleInterface
 {
@@ -13,4 +18,70 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	static FActorInteractionPluginModule& Get()
+	{ return FModuleManager::GetModuleChecked<FActorInteractionPluginModule>("ActorInteractionPlugin"); };
+
+	static bool IsAvailable()
+	{ return FModuleManager::Get().IsModuleLoaded("ActorInteractionPlugin"); };
+
+	/**
+	 * Starts async loading of Default Data Table and Default Widget Class defined in Settings.
+	 * Does nothing if loading has been requested already.
+	 * Called automatically once Engine is initialized.
+	 */
+	void RequestDefaultsLoad();
+	/**
+	 * Releases loaded Defaults and loads them again.
+	 * Called once Default Data Table or Default Widget Class is changed in Settings.
+	 */
+	void ReloadDefaults();
+
+	/**
+	 * Returns whether async loading of Defaults has finished.
+	 */
+	bool AreDefaultsLoaded() const
+	{ return bDefaultsLoaded; };
+
+	/**
+	 * Returns Default Data Table if it is loaded already. Never blocks.
+	 */
+	UDataTable* GetLoadedDefaultDataTable() const
+	{ return CachedDefaultDataTable.Get(); };
+
+	/**
+	 * Returns Default Widget Class if it is loaded already. Never blocks.
+	 */
+	TSubclassOf<UUserWidget> GetLoadedDefaultWidgetClass() const
+	{ return CachedDefaultWidgetClass.Get(); };
+
+	/**
+	 * Stores Defaults which had to be loaded synchronously before async loading finished.
+	 * Stored Defaults are kept loaded as long as the module.
+	 */
+	void CacheDefaultDataTable(UDataTable* DataTable);
+	void CacheDefaultWidgetClass(const TSubclassOf<UUserWidget>& WidgetClass);
+
+	/**
+	 * Event called once async loading of Defaults has finished.
+	 * Check AreDefaultsLoaded before binding, as event is only called again once Defaults are reloaded.
+	 */
+	FSimpleMulticastDelegate& OnDefaultsLoaded()
+	{ return DefaultsLoadedEvent; };
+
+private:
+
+	void HandleDefaultsLoaded();
+
+private:
+
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> DefaultsHandle;
+
+	TStrongObjectPtr<UDataTable> CachedDefaultDataTable;
+	TStrongObjectPtr<UClass> CachedDefaultWidgetClass;
+
+	FSimpleMulticastDelegate DefaultsLoadedEvent;
+
+	bool bDefaultsLoaded = false;
 };
@@ -190,6 +190,8 @@ public:
 	void SetLastInteractionTime(const float NewLastInteractionTime)
 	{
 		LastInteractionTime = NewLastInteractionTime;
+
+		PushInteractionProgressTiming();
 	}
 
 	/**
@@ -202,6 +204,7 @@ public:
 		InteractionTime = NewInteractionTime;
 
 		UpdateInteractableWidget();
+		PushInteractionProgressTiming();
 	}
 
 	/**
@@ -755,6 +758,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interaction|UI")
 	void UpdateInteractableWidget() const;
 
+	/**
+	 * Pushes remaining Interaction Progress and its rate to Interactable User Widget, which interpolates it locally.
+	 * Called whenever Interaction State, Interaction Time or Last Interaction Time changes, so idle Widget does no per-frame work.
+	 */
+	void PushInteractionProgressTiming() const;
+
 public:
 
 #pragma region Events
@@ -29,6 +29,8 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+
+	virtual const TMap<FString, FInteractionKeySetup>& GetDefaultInteractionKeys() const override;
 	
 	virtual void OnInteractionCompletedCallback();
 
@@ -8,13 +8,39 @@
 
 #include "Interfaces/ActorInteractableInterface.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Subsystems/ActorInteractionTimingSubsystem.h"
 
 #include "ActorInteractableComponentBase.generated.h"
 
+class UActorInteractionPromptSubsystem;
+class UActorInteractableDefinition;
+
 #define LOCTEXT_NAMESPACE "InteractableComponent"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWidgetUpdated);
 
+// Rarely bound events use sparse storage, so they cost no memory per Interactable until something binds to them
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE(FLifecycleCompleted, UActorInteractableComponentBase, OnLifecycleCompleted);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE(FCooldownCompleted, UActorInteractableComponentBase, OnCooldownCompleted);
+
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FInteractableAutoSetupChanged, UActorInteractableComponentBase, OnInteractableAutoSetupChanged, const bool, NewValue);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FInteractableWeightChanged, UActorInteractableComponentBase, OnInteractableWeightChanged, const int32&, NewWeight);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FInteractableOwnerChanged, UActorInteractableComponentBase, OnInteractableOwnerChanged, const AActor*, NewOwner);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FInteractableCollisionChannelChanged, UActorInteractableComponentBase, OnInteractableCollisionChannelChanged, const ECollisionChannel, NewCollisionChannel);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FLifecycleModeChanged, UActorInteractableComponentBase, OnLifecycleModeChanged, const EInteractableLifecycle&, NewMode);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FLifecycleCountChanged, UActorInteractableComponentBase, OnLifecycleCountChanged, const int32, NewLifecycleCount);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FCooldownPeriodChanged, UActorInteractableComponentBase, OnCooldownPeriodChanged, const float, NewCooldownPeriod);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FInteractorChanged, UActorInteractableComponentBase, OnInteractorChanged, const TScriptInterface<IActorInteractorInterface>&, NewInteractor);
+
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FHighlightableComponentAdded, UActorInteractableComponentBase, OnHighlightableComponentAdded, const UMeshComponent*, NewHighlightableComp);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FCollisionComponentAdded, UActorInteractableComponentBase, OnCollisionComponentAdded, const UPrimitiveComponent*, NewCollisionComp);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FHighlightableComponentRemoved, UActorInteractableComponentBase, OnHighlightableComponentRemoved, const UMeshComponent*, RemovedHighlightableComp);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FCollisionComponentRemoved, UActorInteractableComponentBase, OnCollisionComponentRemoved, const UPrimitiveComponent*, RemovedCollisionComp);
+
+// Native events for C++ listeners, broadcast before their dynamic counterparts
+DECLARE_MULTICAST_DELEGATE_TwoParams(FInteractableStateChangedNative, UActorInteractableComponentBase*, const EInteractableStateV2&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FInteractorChangedNative, UActorInteractableComponentBase*, const TScriptInterface<IActorInteractorInterface>&);
+
 
 /**
  * Actor Interactable Base Component
@@ -38,10 +64,23 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void InitWidget() override;
 
 	virtual void OnRegister() override;
 
+	/**
+	 * Upgrades Interaction Keys saved before default Keys were shared by all Interactables of the class.
+	 */
+	virtual void Serialize(FArchive& Ar) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * Keeps Movable Interactables at correct location in Interactable Registry.
+	 */
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
 #pragma region InteractableFunctions
 	
 public:
@@ -262,8 +301,86 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interaction")
 	virtual void SetInteractor(const TScriptInterface<IActorInteractorInterface> NewInteractor) override;
 
+	/**
+	 * Returns all Interactors currently holding interaction slot, Interactor is always first.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	TArray<TScriptInterface<IActorInteractorInterface>> GetInteractors() const
+	{ return SlotInteractors; };
+	/**
+	 * Returns Interaction Progress of given Interactor, from 0 to 1.
+	 * Returns -1 if Interactor holds no interaction slot.
+	 * Progress of each Interactor is informative only, Interaction completes on shared Interaction clock.
+	 * 
+	 * @param RequestedInteractor Interactor to be searched for.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	float GetInteractionProgressForInteractor(const TScriptInterface<IActorInteractorInterface>& RequestedInteractor) const;
+	/**
+	 * Returns whether any Interactor holding interaction slot is interacting.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	bool IsAnyInteractorInteracting() const;
+	/**
+	 * Releases interaction slot of Interactor which no longer has this Interactable Active.
+	 * Called by Interactors once their Active Interactable changes. Only affects Interactables with more than one occupied slot.
+	 *
+	 * @param ReleasingInteractor	Interactor which has released this Interactable.
+	 */
+	void ReleaseInteractorSlot(const TScriptInterface<IActorInteractorInterface>& ReleasingInteractor);
+
+	/**
+	 * Returns native State Changed event, which C++ listeners can bind to.
+	 */
+	FInteractableStateChangedNative& GetOnInteractableStateChangedNative()
+	{ return OnInteractableStateChangedNative; };
+	/**
+	 * Returns native Interactor Changed event, which C++ listeners can bind to.
+	 */
+	FInteractorChangedNative& GetOnInteractorChangedNative()
+	{ return OnInteractorChangedNative; };
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	int32 GetMaxConcurrentInteractors() const
+	{ return MaxConcurrentInteractors; };
+	/**
+	 * Sets how many Interactors can use this Interactable at the same time.
+	 * Surplus Interactors are released, newest first.
+	 * 
+	 * @param NewMaxConcurrentInteractors Value to be set. Min value is 1.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void SetMaxConcurrentInteractors(const int32 NewMaxConcurrentInteractors);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	EInteractorArbitration GetInteractorArbitration() const
+	{ return InteractorArbitration; };
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void SetInteractorArbitration(const EInteractorArbitration NewArbitration)
+	{ InteractorArbitration = NewArbitration; };
+
+	/**
+	 * Returns Interactable Definition this Interactable uses.
+	 * Nullptr if Interactable uses only its own values.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	UActorInteractableDefinition* GetInteractableDefinition() const
+	{ return InteractableDefinition; };
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	EInteractablePromptMode GetPromptMode() const
+	{ return PromptMode; };
+
+	/**
+	 * Pushes data of this Interactable to given Widget, including timing Widget needs to interpolate progress locally.
+	 * 
+	 * @param TargetWidget	Widget to be updated. Either implements ActorInteractionWidget Interface or is Actor Interactable Widget.
+	 */
+	void PushWidgetData(UUserWidget* TargetWidget);
+
 	/**
 	 * Returns Interaction Progress.
+	 * Progress is computed from Interaction Start Time, so it is cheap to be called every frame.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
 	virtual float GetInteractionProgress() const override;
@@ -298,6 +415,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interaction")
 	virtual void SetInteractableWeight(const int32 NewWeight) override;
 
+	/**
+	 * Returns World Time when Interaction was last completed.
+	 * Negative if this Interactable was never interacted with.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual float GetLastInteractionTime() const override
+	{ return LastInteractionTime; };
+
 	/**
 	 * Return Interactable Owner.
 	 * This will be most likely same as the GetOwner, however, there is a way to override this default value.
@@ -409,6 +534,17 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
 	virtual bool FindKey(const FKey& RequestedKey, const FString& Platform) const override;
+	/**
+	 * Returns all Interaction Keys for running platform.
+	 * Once Interactable has begun play, Keys are taken from Interaction Key Table without any platform name lookup.
+	 * Key set is resolved again after Keys have changed.
+	 */
+	const TArray<FKey>& GetRunningPlatformKeys() const;
+	/**
+	 * Checks for Key in Interaction Keys of running platform.
+	 * @param RequestedKey Key which you are looking for.
+	 */
+	bool HasRunningPlatformKey(const FKey& RequestedKey) const;
 	
 	/**
 	 * Returns all Collision Components.
@@ -870,6 +1006,81 @@ protected:
 protected:
 	
 	virtual void CleanupComponent();
+
+	/**
+	 * Returns index of interaction slot held by given Interactor or INDEX_NONE.
+	 */
+	int32 FindInteractorSlot(const TScriptInterface<IActorInteractorInterface>& RequestedInteractor) const
+	{ return SlotInteractors.Find(RequestedInteractor); };
+	/**
+	 * Gives Found Interactor interaction slot next to Interactor, resolving full slots by Interactor Arbitration.
+	 * Only used with more than one Max Concurrent Interactors.
+	 *
+	 * @return Whether Found Interactor holds slot.
+	 */
+	bool AcquireInteractorSlot(const TScriptInterface<IActorInteractorInterface>& FoundInteractor);
+	/**
+	 * Releases interaction slot and lets its Interactor know this Interactable is no longer available.
+	 * If slot of Interactor is released, next Interactor is promoted.
+	 */
+	void EvictInteractorSlot(const int32 SlotIndex);
+	void AddInteractorSlot(const TScriptInterface<IActorInteractorInterface>& NewInteractor, const int32 SlotIndex);
+	void RemoveInteractorSlot(const int32 SlotIndex);
+	void ClearInteractorSlots();
+	void ResetInteractorSlotsProgress();
+	/**
+	 * Returns Timing Subsystem of World, which drives all Interaction Timers.
+	 * Nullptr if there is no World or World type is not supported.
+	 */
+	UActorInteractionTimingSubsystem* GetTimingSubsystem() const;
+	/**
+	 * Returns Prompt Subsystem of Local Player controlling Interactor.
+	 * Nullptr if there is no Interactor or it is not controlled by Local Player.
+	 */
+	UActorInteractionPromptSubsystem* FindPromptSubsystem() const;
+	/**
+	 * Returns time used by Interaction clock.
+	 * Server World Time is used, so replicated Interaction Start Time is valid on Clients as well.
+	 */
+	double GetInteractionClockTime() const;
+	/**
+	 * Returns seconds of current interaction, excluding time spent paused.
+	 * Returns 0 if there is no interaction.
+	 */
+	float GetInteractionElapsed() const;
+	/**
+	 * Starts Interaction clock or resumes it from pause.
+	 * Starting Interactor owns the clock and is credited with completing Interaction.
+	 */
+	void StartInteractionClock(const TScriptInterface<IActorInteractorInterface>& StartingInteractor);
+	/**
+	 * Returns Interactor which owns Interaction clock, or Interactor if the clock has no owner.
+	 */
+	TScriptInterface<IActorInteractorInterface> GetClockInteractor() const
+	{ return ClockInteractor.GetObject() != nullptr ? ClockInteractor : GetInteractor(); };
+	/**
+	 * Passes Interaction clock from Releasing Interactor to another interacting slot, if there is any.
+	 */
+	void HandOverInteractionClock(const TScriptInterface<IActorInteractorInterface>& ReleasingInteractor);
+	/**
+	 * Freezes Interaction clock, keeping elapsed time.
+	 */
+	void PauseInteractionClock();
+	void ResetInteractionClock();
+	bool IsInteractionClockPaused() const
+	{ return InteractionPausedElapsed >= 0.0; };
+	/**
+	 * Returns inverse of Interaction Period, so progress does not need division.
+	 * Derived from Interaction Period on every call, so it is valid on Clients which only receive Interaction clock.
+	 */
+	float GetInteractionPeriodInverse() const
+	{ return 1.f / FMath::Max(InteractionPeriod, 0.01f); };
+	/**
+	 * Called on Clients once Interaction clock is replicated, so their Widgets show new progress.
+	 * Clients only display progress, completion and its Timers are driven by Server.
+	 */
+	UFUNCTION()
+	void OnRep_InteractionClock();
 	virtual void FindAndAddCollisionShapes() override;
 	virtual void FindAndAddHighlightableMeshes() override;
 	
@@ -931,6 +1142,60 @@ protected:
 	bool ValidateInteractable() const;
 
 	virtual void UpdateInteractionWidget();
+	/**
+	 * Marks parts of Widget as changed.
+	 * Widget is updated once at the start of next frame, no matter how many changes were made.
+	 */
+	void MarkWidgetDirty(const EInteractableWidgetDirty DirtyFlags);
+	UFUNCTION()
+	void FlushWidgetUpdate();
+
+	/**
+	 * Copies values of Interactable Definition, which are not overridden, to this Interactable.
+	 * Only values which are changed at runtime are copied, Keys, Ignored Classes and Name are read from Definition directly.
+	 */
+	void ApplyInteractableDefinition();
+	/**
+	 * Returns Interaction Keys from this Interactable if overridden, otherwise from Definition or class defaults.
+	 */
+	const TMap<FString, FInteractionKeySetup>& GetResolvedInteractionKeys() const;
+	/**
+	 * Returns Interaction Keys this Interactable can modify.
+	 * Resolved Keys are copied to this Interactable and marked as overridden first.
+	 */
+	TMap<FString, FInteractionKeySetup>& GetMutableInteractionKeys();
+	/**
+	 * Returns Ignored Classes from Definition or this Interactable, whichever applies.
+	 */
+	const TArray<TSoftClassPtr<UObject>>& GetResolvedIgnoredClasses() const;
+	/**
+	 * Returns Ignored Classes this Interactable can modify.
+	 * Ignored Classes of Definition are copied to this Interactable and marked as overridden first.
+	 */
+	TArray<TSoftClassPtr<UObject>>& GetMutableIgnoredClasses();
+	/**
+	 * Updates index of running platform Key set in Interaction Key Table.
+	 */
+	void RefreshRunningPlatformKeys();
+	/**
+	 * Marks running platform Key set as outdated, it is resolved again once Keys are requested.
+	 */
+	void InvalidateRunningPlatformKeys()
+	{ RunningPlatformKeySet = INDEX_NONE; };
+	/**
+	 * Keys used when neither Definition nor this Interactable define any.
+	 * Shared by all instances of the class, so Interactables do not build their own Keys in constructor.
+	 */
+	virtual const TMap<FString, FInteractionKeySetup>& GetDefaultInteractionKeys() const;
+
+	/**
+	 * Calls OnInteractableStateChangedEvent and broadcasts native and dynamic State Changed events.
+	 */
+	void BroadcastInteractableStateChanged(const EInteractableStateV2& NewState);
+	/**
+	 * Calls OnInteractorChangedEvent and broadcasts native and dynamic Interactor Changed events.
+	 */
+	void BroadcastInteractorChanged(const TScriptInterface<IActorInteractorInterface>& NewInteractor);
 	
 	UFUNCTION()	virtual void OnCooldownCompletedCallback();
 	UFUNCTION() virtual void InteractableDependencyStartedCallback(const TScriptInterface<IActorInteractableInterface>& NewMaster) override;
@@ -1180,6 +1445,17 @@ protected:
 	UPROPERTY(BlueprintAssignable, Category="Interaction")
 	FInteractorChanged OnInteractorChanged;
 
+	/**
+	 * Native version of OnInteractableStateChanged for C++ listeners.
+	 * Provides Interactable which State has changed, so one handler can listen to many Interactables.
+	 */
+	FInteractableStateChangedNative OnInteractableStateChangedNative;
+
+	/**
+	 * Native version of OnInteractorChanged for C++ listeners.
+	 */
+	FInteractorChangedNative OnInteractorChangedNative;
+
 	FInteractableDependencyStarted InteractableDependencyStarted;
 
 	FInteractableDependencyStopped InteractableDependencyStopped;
@@ -1217,7 +1493,7 @@ protected:
 	virtual FInteractableDependencyStopped& GetInteractableDependencyStopped() override
 	{ return InteractableDependencyStopped; };
 
-	virtual FTimerHandle& GetCooldownHandle() override
+	virtual FInteractionTimerHandle& GetCooldownHandle() override
 	{ return Timer_Cooldown; };
 
 	virtual FInteractableStateChanged& GetInteractableStateChanged() override
@@ -1346,6 +1622,36 @@ protected:
 #pragma region Optional
 
 protected:
+
+	/**
+	 * Definition shared by Interactables of the same kind, like all crates in a level.
+	 * If set, Interaction Period, Lifecycle Mode, Lifecycle Count, Cooldown Period, Interaction Keys, Ignored Classes and Name
+	 * are taken from Definition, unless overridden on this Interactable.
+	 * Interactables using Definition do not keep their own copy of Interaction Keys and Ignored Classes.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(NoResetToDefault))
+	UActorInteractableDefinition* InteractableDefinition = nullptr;
+
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="InteractableDefinition != nullptr", EditConditionHides))
+	uint8 bOverride_InteractionPeriod : 1;
+
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="InteractableDefinition != nullptr", EditConditionHides))
+	uint8 bOverride_LifecycleMode : 1;
+
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="InteractableDefinition != nullptr", EditConditionHides))
+	uint8 bOverride_LifecycleCount : 1;
+
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="InteractableDefinition != nullptr", EditConditionHides))
+	uint8 bOverride_CooldownPeriod : 1;
+
+	UPROPERTY(SaveGame, EditAnywhere, Category="Interaction|Optional", meta=(InlineEditConditionToggle))
+	uint8 bOverride_InteractionKeysPerPlatform : 1;
+
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="InteractableDefinition != nullptr", EditConditionHides))
+	uint8 bOverride_IgnoredClasses : 1;
+
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="InteractableDefinition != nullptr", EditConditionHides))
+	uint8 bOverride_InteractableName : 1;
 	
 	/**
 	 * List of Interactable Classes which are ignored
@@ -1397,8 +1703,10 @@ protected:
 	/**
 	* List of Interaction Keys for each platform.
 	* There is no validation for Keys validation! Nothing stops you from setting Keyboard keys for Consoles. Please, be careful with this variable!
+	* Unless overridden, Keys of Interactable Definition or default Keys of this Interactable class are used.
+	* Overridden Keys are used even if empty, so the Interactable cannot be triggered by any Key.
 	*/
-	UPROPERTY(SaveGame, EditAnywhere, Category="Interaction|Optional", meta=(NoResetToDefault))
+	UPROPERTY(SaveGame, EditAnywhere, Category="Interaction|Optional", meta=(NoResetToDefault, EditCondition="bOverride_InteractionKeysPerPlatform"))
 	TMap<FString, FInteractionKeySetup> InteractionKeysPerPlatform;
 
 	/**
@@ -1441,6 +1749,29 @@ protected:
 	UPROPERTY(SaveGame, EditAnywhere, Category="Interaction|Optional", meta=(UIMin=0.001, ClampMin=0.001, Units="seconds", EditCondition="ComparisonMethod!=ETimingComparison::ECM_None", NoResetToDefault))
 	float TimeToStart;
 
+	/**
+	 * How many Interactors can use this Interactable at the same time, like multiple players at one lever.
+	 * Interactor, which was found first, drives Interaction Events, others hold their own interaction slots with informative progress.
+	 * Completion is credited to Interactor which owns Interaction clock, which might be any of them.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, Category="Interaction|Optional", meta=(UIMin=1, ClampMin=1, NoResetToDefault))
+	int32 MaxConcurrentInteractors;
+
+	/**
+	 * Defines which Interactor gets the slot once all Max Concurrent Interactors slots are taken.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, Category="Interaction|Optional", meta=(NoResetToDefault))
+	EInteractorArbitration InteractorArbitration;
+
+	/**
+	 * Defines whether this Interactable owns its Widget or uses pooled Widget or batched Prompt of Local Player Prompt Subsystem.
+	 * Pooled Prompt Mode is recommended for levels with many Interactables, like pickups, as no Widget is created for each of them.
+	 * Widget Class is still used to select pooled Widget.
+	 * Batched Prompt Mode paints Key, Name and Progress of all batched Interactables in single Slate Prompt Layer, Widget Class is ignored.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(NoResetToDefault))
+	EInteractablePromptMode PromptMode;
+
 #pragma endregion 
 
 #pragma region ReadOnly
@@ -1501,13 +1832,72 @@ protected:
 	 */
 	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
 	int32 CachedInteractionWeight;
+
+	/**
+	 * World Time when Interaction was last completed.
+	 * Used by Interactors to score candidates.
+	 */
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	float LastInteractionTime;
+
+	/**
+	 * Interaction slots stored as parallel arrays, slot 0 always belongs to Interactor.
+	 * Start Time is negative while slot is not interacting, Progress holds progress made before last stop.
+	 */
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	TArray<TScriptInterface<IActorInteractorInterface>> SlotInteractors;
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	TArray<float> SlotStartTimes;
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	TArray<FKey> SlotKeys;
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	TArray<float> SlotProgress;
+	
+	/**
+	 * Server World Time at which current interaction would have started if it has never been paused.
+	 * Negative while there is no interaction.
+	 * Progress is derived from this value, so it is only replicated once interaction starts, pauses or ends.
+	 * Clients derive displayed progress from it, but never arm completion Timers.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_InteractionClock, VisibleAnywhere, Category="Interaction|Read Only")
+	double InteractionStartTime;
+
+	/**
+	 * Seconds of interaction made before Interaction clock was paused.
+	 * Negative while Interaction clock is not paused.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_InteractionClock, VisibleAnywhere, Category="Interaction|Read Only")
+	double InteractionPausedElapsed;
+
+	/**
+	 * Interactor which started or took over Interaction clock.
+	 * With more than one Max Concurrent Interactors it might not be Interactor.
+	 */
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	TScriptInterface<IActorInteractorInterface> ClockInteractor;
+
+	/**
+	 * Prompt Subsystem currently displaying pooled Widget for this Interactable.
+	 */
+	TWeakObjectPtr<UActorInteractionPromptSubsystem> ActivePromptSubsystem;
+
+	/**
+	 * Parts of Widget changed since Widget was last updated.
+	 */
+	EInteractableWidgetDirty PendingWidgetUpdates;
+
+	/**
+	 * Index of running platform Key set in Interaction Key Table.
+	 * INDEX_NONE until Interactable begins play or once Keys change, per-platform Keys are searched instead.
+	 */
+	mutable int32 RunningPlatformKeySet;
 	
 	UPROPERTY()
-	FTimerHandle Timer_Interaction;
+	FInteractionTimerHandle Timer_Interaction;
 	UPROPERTY()
-	FTimerHandle Timer_Cooldown;
+	FInteractionTimerHandle Timer_Cooldown;
 	UPROPERTY()
-	FTimerHandle Timer_ProgressExpiration;
+	FInteractionTimerHandle Timer_ProgressExpiration;
 
 private:
 	
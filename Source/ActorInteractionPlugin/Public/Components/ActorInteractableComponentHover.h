@@ -28,6 +28,8 @@ protected:
 
 	virtual bool CanInteract() const override;
 
+	virtual const TMap<FString, FInteractionKeySetup>& GetDefaultInteractionKeys() const override;
+
 	
 	UFUNCTION()
 	void OnHoverBeginsEvent(UPrimitiveComponent* PrimitiveComponent);
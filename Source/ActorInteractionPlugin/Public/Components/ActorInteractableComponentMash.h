@@ -89,7 +89,7 @@ protected:
 
 protected:
 
-	FTimerHandle TimerHandle_Mashed;
+	FInteractionTimerHandle TimerHandle_Mashed;
 
 	/**
 	 * How many times the key was mashed.
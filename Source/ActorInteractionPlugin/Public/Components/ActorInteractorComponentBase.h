@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/InteractionCandidateScoring.h"
 #include "Interfaces/ActorInteractorInterface.h"
 #include "ActorInteractorComponentBase.generated.h"
 
@@ -288,6 +289,104 @@ public:
 	UFUNCTION(BlueprintCallable, CallInEditor, Category="Interaction", meta=(DevelopmentOnly))
 	virtual void ToggleDebug() override;
 
+	/**
+	 * Returns whether Challenger should replace current Active Interactable.
+	 * Challenger Score must be higher by more than Selection Score Margin and Active Interactable must have been active
+	 * for at least Minimum Dwell Time.
+	 * Scores computed by last trace or overlap update are reused when both Interactables were part of it.
+	 *
+	 * @param Challenger	Interactable competing with Active Interactable.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual bool ShouldReplaceActiveInteractable(const TScriptInterface<IActorInteractableInterface>& Challenger) const;
+
+	/**
+	 * Returns how many times Active Interactable was kept because Challenger did not win by Selection Score Margin
+	 * or Minimum Dwell Time did not elapse yet.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	int32 GetSuppressedSelectionTransitions() const
+	{ return SuppressedSelectionTransitions; };
+
+	/**
+	 * Returns best Interactables found by last trace or current overlaps, ordered from highest Score.
+	 * Contains at most Max Top Candidates entries.
+	 */
+	TConstArrayView<FInteractionCandidate> GetTopCandidates() const
+	{ return TopCandidates; };
+	/**
+	 * Returns best Interactables found by last trace or current overlaps, ordered from highest Score.
+	 * Contains at most Max Top Candidates entries.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction", meta=(DisplayName = "Get Top Candidates"))
+	TArray<FInteractionCandidate> K2_GetTopCandidates() const
+	{ return TopCandidates; };
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	int32 GetMaxTopCandidates() const
+	{ return MaxTopCandidates; };
+	/**
+	 * Sets how many best Interactables are kept in Top Candidates.
+	 * 
+	 * @param NewMaxTopCandidates	Value to be set. 0 disables Top Candidates.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void SetMaxTopCandidates(const int32 NewMaxTopCandidates);
+
+	/**
+	 * Returns Scoring Policy used to rank candidates.
+	 * If none is set, candidates are ranked by Interactable Weight.
+	 */
+	TScriptInterface<IInteractionScoringPolicy> GetScoringPolicy() const
+	{ return ScoringPolicy; };
+	/**
+	 * Sets Scoring Policy used to rank candidates.
+	 * 
+	 * @param NewPolicy	Policy to be used. Null ranks candidates by Interactable Weight.
+	 */
+	void SetScoringPolicy(const TScriptInterface<IInteractionScoringPolicy>& NewPolicy);
+
+protected:
+
+	/**
+	 * Counts selection transition which was suppressed by Selection Hysteresis.
+	 */
+	void NotifySelectionTransitionSuppressed();
+
+	/**
+	 * Returns whether Challenger with given Score can replace Active Interactable with given Score.
+	 * Applies Minimum Dwell Time and Selection Score Margin.
+	 */
+	bool IsSelectionTransitionAllowed(const float ChallengerScore, const float ActiveScore) const;
+
+	/**
+	 * Appends Interactable to Candidates, measured from Owner view point.
+	 * Used where no Hit Result is available, like for Overlap Interactors.
+	 *
+	 * @param Interactable	Interactable to be added.
+	 * @param Candidates	Candidates to be appended to.
+	 * @return				Index of new candidate or INDEX_NONE.
+	 */
+	virtual int32 GatherCandidate(const TScriptInterface<IActorInteractableInterface>& Interactable, FInteractionCandidateSoA& Candidates) const;
+
+	/**
+	 * Returns seconds since given Interactable was interacted with.
+	 */
+	float GetTimeSinceInteraction(const TScriptInterface<IActorInteractableInterface>& Interactable) const;
+
+	/**
+	 * Pads Candidates and fills their Scores using Scoring Policy.
+	 */
+	virtual void ScoreCandidates(FInteractionCandidateSoA& Candidates) const;
+
+	/**
+	 * Selects best Max Top Candidates from scored Candidates using bounded heap.
+	 * Calls OnTopCandidatesChanged only if membership or order has changed.
+	 *
+	 * @param Candidates	Scored candidates. Duplicates keep their highest Score.
+	 */
+	void UpdateTopCandidates(const FInteractionCandidateSoA& Candidates);
+
 protected:
 
 	/**
@@ -346,6 +445,12 @@ protected:
 	 */
 	UPROPERTY(BlueprintAssignable, Category="Interaction")
 	FIgnoredActorRemoved OnIgnoredActorRemoved;
+	/**
+	 * This event is called once Top Candidates change their membership or order.
+	 * Changed Scores alone do not call this event.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Interaction")
+	FTopCandidatesChanged OnTopCandidatesChanged;
 
 protected:
 
@@ -384,8 +489,53 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(NoResetToDefault, DisplayThumbnail=false))
 	TArray<AActor*> ListOfIgnoredActors;
 
+	/**
+	 * Selection Hysteresis.
+	 * Minimum time in seconds Active Interactable stays selected before any other Interactable can replace it.
+	 * Active Interactable can still be lost at any time, once it is no longer found.
+	 * 
+	 * Prevents OnInteractableLost/OnInteractableSelected storms when multiple Interactables compete for selection.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(Units = "s", UIMin=0, ClampMin=0))
+	float MinimumDwellTime;
+
+	/**
+	 * Selection Hysteresis.
+	 * How much higher Score of Challenger must be to replace Active Interactable.
+	 * With 0, any Interactable with higher Score replaces Active Interactable.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(UIMin=0, ClampMin=0))
+	float SelectionScoreMargin;
+
+	/**
+	 * Scoring Policy ranking candidates gathered by trace or overlap.
+	 * Interaction Scoring Weights Data Asset can be used to configure scoring without code.
+	 * If none is set, candidates are ranked by Interactable Weight.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional")
+	TScriptInterface<IInteractionScoringPolicy> ScoringPolicy;
+
+	/**
+	 * How many best Interactables are kept in Top Candidates, useful for radial menus and similar.
+	 * 0 disables Top Candidates.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(UIMin=0, ClampMin=0))
+	int32 MaxTopCandidates;
+
+	/**
+	 * Candidates gathered and scored by last trace or overlap update.
+	 * Selection Hysteresis reuses their Scores, so it never disagrees with selection.
+	 */
+	FInteractionCandidateSoA CandidateBuffer;
+
 private:
 
+	/**
+	 * Candidates scored for Selection Hysteresis when Active Interactable or Challenger is missing from Candidate Buffer.
+	 * Mutable, as Selection Hysteresis is evaluated from const selection.
+	 */
+	mutable FInteractionCandidateSoA SelectionCandidateBuffer;
+
 	/**
 	 * Current read-only State of this Interactor.
 	 */
@@ -400,6 +550,18 @@ private:
 	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
 	TArray<TScriptInterface<IActorInteractorInterface>> InteractionDependencies;
 
+	// World time when Active Interactable was selected
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	float ActiveInteractableSelectedTime;
+
+	// How many selection transitions were suppressed by Selection Hysteresis
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	int32 SuppressedSelectionTransitions;
+
+	// Best Interactables ordered from highest Score
+	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
+	TArray<FInteractionCandidate> TopCandidates;
+
 #pragma region Editor
 
 #if WITH_EDITOR
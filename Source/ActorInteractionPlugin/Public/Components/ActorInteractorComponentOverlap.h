@@ -28,6 +28,38 @@ protected:
 
 	virtual void SetState(const EInteractorStateV2 NewState) override;
 
+	virtual void InteractableFound(const TScriptInterface<IActorInteractableInterface>& FoundInteractable) override;
+	virtual void InteractableLost(const TScriptInterface<IActorInteractableInterface>& LostInteractable) override;
+
+	/**
+	 * Removes overlapped Interactables owned by Other Actor from candidates, once none of their Collision Components
+	 * overlaps any Collision Shape anymore.
+	 * Interactables which are not Active do not report end of overlap to this Interactor, therefore Collision Shapes are listened to directly.
+	 */
+	UFUNCTION()
+	virtual void OnCollisionShapeEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	/**
+	 * Refreshes Top Candidates once any overlapped Interactable changes its State.
+	 */
+	UFUNCTION()
+	void OnOverlappedInteractableStateChanged(const EInteractableStateV2& NewState);
+
+	/**
+	 * Returns whether any Collision Component of Interactable overlaps any Collision Shape of this Interactor.
+	 */
+	bool IsOverlappingInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable) const;
+
+	/**
+	 * Removes Interactable from Overlapped Interactables and stops listening to its State changes.
+	 */
+	void RemoveOverlappedInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable);
+
+	/**
+	 * Scores all overlapped Interactables and updates Top Candidates.
+	 */
+	void RefreshTopCandidates();
+
 	virtual UPrimitiveComponent* FindComponentByName(const FName& CollisionComponentName);
 	virtual void SetupInteractorOverlap();
 	virtual void BindCollisions();
@@ -71,6 +103,12 @@ private:
 	 */
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="Interaction|Read Only", meta=(DisplayThumbnail = false, ShowOnlyInnerProperties))
 	mutable TMap<UPrimitiveComponent*, FCollisionShapeCache> CachedCollisionShapesSettings;
+
+	/**
+	 * All Interactables currently overlapped, including those which are not Active.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, Category="Interaction|Read Only")
+	TArray<TScriptInterface<IActorInteractableInterface>> OverlappedInteractables;
 	
 };
 
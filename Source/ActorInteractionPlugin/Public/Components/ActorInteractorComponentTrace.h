@@ -6,8 +6,12 @@
 #include "ActorInteractorComponentBase.h"
 #include "CollisionQueryParams.h"
 #include "Engine/HitResult.h"
+#include "Subsystems/ActorInteractableRegistrySubsystem.h"
+#include "WorldCollision.h"
 #include "ActorInteractorComponentTrace.generated.h"
 
+class UInteractionSignificanceProvider;
+
 /**
  * 
  */
@@ -16,10 +20,79 @@ enum class ETraceType : uint8
 {
 	ETT_Precise		UMETA(DisplayName = "Precise", Tooltip = "Raycast/Line Trace."),
 	ETT_Loose		UMETA(DisplayName = "Loose", Tooltip = "Cubecast/Cube Trace."),
+	ETT_Spatial		UMETA(DisplayName = "Spatial", Tooltip = "View cone query against registered Interactables, best candidates confirmed by Line Trace."),
 
 	Default
 };
 
+/**
+ * Mobility of objects considered by Interaction traces.
+ */
+UENUM(BlueprintType)
+enum class EInteractionQueryMobility : uint8
+{
+	EIQM_Any		UMETA(DisplayName = "Any", Tooltip = "Both Static and Movable objects are traced."),
+	EIQM_Static		UMETA(DisplayName = "Static", Tooltip = "Only Static objects are traced."),
+	EIQM_Dynamic	UMETA(DisplayName = "Dynamic", Tooltip = "Only Stationary and Movable objects are traced."),
+
+	Default			UMETA(Hidden)
+};
+
+#pragma region TraceQueryProfile
+/**
+ * Features requested from physics by Interaction traces.
+ * Defaults are the cheapest set needed to select Interactables.
+ */
+USTRUCT(BlueprintType)
+struct FInteractionTraceQueryProfile
+{
+	GENERATED_BODY()
+
+	/**
+	 * Whether Physical Material of hit is returned. Not needed for selection.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceQueryProfile", EditAnywhere, BlueprintReadWrite)
+	uint8 bReturnPhysicalMaterial : 1;
+	/**
+	 * Whether Face Index of hit is returned. Only valid with complex collision. Not needed for selection.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceQueryProfile", EditAnywhere, BlueprintReadWrite)
+	uint8 bReturnFaceIndex : 1;
+	/**
+	 * Whether complex (per-poly) collision is traced instead of simple collision.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceQueryProfile", EditAnywhere, BlueprintReadWrite)
+	uint8 bTraceComplex : 1;
+	/**
+	 * Mobility of objects considered by trace.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceQueryProfile", EditAnywhere, BlueprintReadWrite)
+	EInteractionQueryMobility MobilityFilter;
+
+	FInteractionTraceQueryProfile() :
+	bReturnPhysicalMaterial(false),
+	bReturnFaceIndex(false),
+	bTraceComplex(false),
+	MobilityFilter(EInteractionQueryMobility::EIQM_Any)
+	{};
+
+	inline bool operator==(const FInteractionTraceQueryProfile& Other) const
+	{
+		return
+		bReturnPhysicalMaterial == Other.bReturnPhysicalMaterial &&
+		bReturnFaceIndex == Other.bReturnFaceIndex &&
+		bTraceComplex == Other.bTraceComplex &&
+		MobilityFilter == Other.MobilityFilter
+		;
+	}
+
+	inline bool operator!=(const FInteractionTraceQueryProfile& Other) const
+	{
+		return !(*this==Other);
+	}
+};
+#pragma endregion 
+
 /**
  * Interaction Tracing Data used easier data management.
  */
@@ -29,7 +102,9 @@ struct FInteractionTraceDataV2
 	FVector EndLocation;
 	FRotator TraceRotation;
 	TArray<FHitResult> HitResults;
-	FCollisionQueryParams CollisionParams;
+	// Params are owned by Interactor and only referenced, so they are never copied per trace
+	const FCollisionQueryParams* CollisionParams;
+	const FCollisionObjectQueryParams* ObjectQueryParams;
 	ECollisionChannel CollisionChannel;
 
 	// Default zero constructor
@@ -38,7 +113,8 @@ struct FInteractionTraceDataV2
 		StartLocation = FVector();
 		EndLocation = FVector();
 		TraceRotation = FRotator();
-		CollisionParams = FCollisionQueryParams();
+		CollisionParams = &FCollisionQueryParams::DefaultQueryParam;
+		ObjectQueryParams = &FCollisionObjectQueryParams::DefaultObjectQueryParam;
 		CollisionChannel = ECC_Visibility;
 	};
 	
@@ -47,7 +123,8 @@ struct FInteractionTraceDataV2
 		StartLocation = Start;
 		EndLocation = End;
 		TraceRotation = Rotation;
-		CollisionParams = Params;
+		CollisionParams = &Params;
+		ObjectQueryParams = &FCollisionObjectQueryParams::DefaultObjectQueryParam;
 		CollisionChannel = Channel;
 	};
 };
@@ -125,6 +202,8 @@ class ACTORINTERACTIONPLUGIN_API UActorInteractorComponentTrace : public UActorI
 {
 	GENERATED_BODY()
 
+	friend class UActorInteractionTraceSubsystem;
+
 public:
 
 	UActorInteractorComponentTrace();
@@ -132,16 +211,19 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 protected:
 
 	/**
-	 * Disables Tracing. Can be Enabled again. Clears all timers.
+	 * Disables Tracing. Can be Enabled again.
+	 * Unregisters this Interactor from Trace Subsystem.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Interaction|Tracing")
 	virtual void DisableTracing();
 	/**
 	 * Tries to enable Tracing. Could fail if non valid state.
+	 * Registers this Interactor to Trace Subsystem which then processes traces in batches once per frame.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Interaction|Tracing")
 	virtual void EnableTracing();
@@ -153,9 +235,96 @@ protected:
 	UFUNCTION()
 	virtual void ResumeTracing();
 
+	/**
+	 * Processes one trace immediately, outside of Trace Subsystem schedule.
+	 */
 	UFUNCTION()	virtual void ProcessTrace();
+	/**
+	 * Fills query descriptor for next trace.
+	 * Called by Trace Subsystem when Trace Interval elapsed.
+	 *
+	 * @param InteractionTraceData	Trace Data to be filled.
+	 * @return						False if this Interactor cannot trace now.
+	 */
+	virtual bool PrepareTrace(FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Returns Location and Rotation the trace starts from.
+	 * Either Custom Trace Start or Owner's Eyes Viewpoint.
+	 */
+	virtual void GetTraceViewpoint(FVector& OutLocation, FRotator& OutRotation) const;
+	/**
+	 * Returns whether given viewpoint differs from the one used by last trace more than Adaptive thresholds allow.
+	 */
+	bool HasTraceViewpointMoved(const FVector& Location, const FRotator& Rotation) const;
+	/**
+	 * Stretches Effective Trace Interval while viewpoint is still, resets it to Trace Interval once viewpoint moves.
+	 */
+	void UpdateAdaptiveTraceInterval(const FVector& Location, const FRotator& Rotation);
+	/**
+	 * Evaluates Significance Provider and applies selected trace-rate tier.
+	 * Suspends or resumes tracing if needed.
+	 * Called periodically by Trace Subsystem.
+	 */
+	virtual void UpdateSignificance();
+	/**
+	 * Returns whether stretched interval should be cut short because viewpoint has moved.
+	 * Called by Trace Subsystem every frame before interval elapses.
+	 */
+	bool ShouldTraceEarly() const;
+	/**
+	 * Returns cached Collision Params, rebuilding them first if Ignored Actors, Response Channel or Trace Query Profile changed.
+	 */
+	const FCollisionQueryParams& GetTraceCollisionParams();
+	/**
+	 * Executes query described by Trace Data. Hit Results are stored in Trace Data.
+	 *
+	 * @param InteractionTraceData	Trace Data prepared by PrepareTrace.
+	 * @return						True if Hit Results are available immediately, false if trace was submitted asynchronously.
+	 */
+	virtual bool ExecuteTrace(FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Selects best Interactable from Hit Results and broadcasts events.
+	 *
+	 * @param InteractionTraceData	Trace Data filled by ExecuteTrace.
+	 */
+	virtual void ResolveTrace(FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Returns Interactables using Collision Component of given Hit Result.
+	 * Interactable Registry is asked first. Collision Components which were never registered, for example
+	 * those of custom IActorInteractableInterface implementations, are resolved by searching Components of hit Actor.
+	 *
+	 * @param Registry				Interactable Registry of this World.
+	 * @param HitResult				Hit Result to resolve.
+	 * @return						Null if no Interactable is using hit Component.
+	 */
+	const FInteractableList* FindHitInteractables(const UActorInteractableRegistrySubsystem* Registry, const FHitResult& HitResult);
 	virtual void ProcessTrace_Precise(FInteractionTraceDataV2& InteractionTraceData);
 	virtual void ProcessTrace_Loose(FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Queries Interactable Registry for Interactables inside view cone and confirms best of them
+	 * with line of sight Line Trace. Physics is only used for confirmation traces.
+	 */
+	virtual void ProcessTrace_Spatial(FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Returns location Spatial confirmation trace aims at.
+	 * Bounds origin of Collision Component closest to view direction is used, Interactable location only if it has none.
+	 */
+	FVector GetSpatialConfirmationTarget(const UActorInteractableComponentBase* Candidate, const FVector& TraceStart, const FVector& TraceDirection) const;
+	/**
+	 * Submits Precise or Loose trace to physics async query API.
+	 * Results are consumed on next frame in OnAsyncTraceCompleted.
+	 */
+	virtual void ProcessTrace_Async(FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Called by World once async trace submitted in previous frame is done.
+	 */
+	virtual void OnAsyncTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	/**
+	 * Returns whether async trace has been submitted and its results are not consumed yet.
+	 */
+	bool IsAsyncTracePending() const
+	{ return AsyncTraceHandle.IsValid(); };
 
 	/**
 	 * Returns whether Tracing is allowed or not.
@@ -232,6 +401,95 @@ protected:
 	UFUNCTION(BlueprintCallable, Category="Interaction")
 	virtual void SetUseCustomStartTransform(const bool bUse);
 
+	/**
+	 * Returns whether Adaptive Trace Interval is used.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual bool GetUseAdaptiveTraceInterval() const;
+	/**
+	 * Sets whether Adaptive Trace Interval is used.
+	 * Effective Trace Interval is reset to Trace Interval.
+	 *
+	 * @param bUse	Value to be set
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	virtual void SetUseAdaptiveTraceInterval(const bool bUse);
+
+	/**
+	 * Returns Trace Interval in seconds currently used for scheduling.
+	 * Equals Trace Interval unless Adaptive Trace Interval stretched it.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	float GetEffectiveTraceInterval() const;
+	/**
+	 * Returns how many traces per second are currently processed.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	float GetEffectiveTraceRate() const;
+
+	/**
+	 * Returns whether Single Hit Trace is used.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual bool GetUseSingleHitTrace() const;
+	/**
+	 * Sets whether Single Hit Trace is used.
+	 * Pending async trace, if any, is discarded.
+	 *
+	 * @param bUse	Value to be set
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	virtual void SetUseSingleHitTrace(const bool bUse);
+
+	/**
+	 * Returns Trace Query Profile.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual FInteractionTraceQueryProfile GetTraceQueryProfile() const;
+	/**
+	 * Sets Trace Query Profile.
+	 * Cached Collision Params are rebuilt before next trace.
+	 *
+	 * @param NewProfile	Value to be set
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	virtual void SetTraceQueryProfile(const FInteractionTraceQueryProfile& NewProfile);
+
+	/**
+	 * Returns Significance Provider. Might be null.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual UInteractionSignificanceProvider* GetSignificanceProvider() const;
+	/**
+	 * Sets Significance Provider.
+	 * If null is provided, tracing is restored to full rate.
+	 *
+	 * @param NewProvider	Value to be set
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	virtual void SetSignificanceProvider(UInteractionSignificanceProvider* NewProvider);
+
+	/**
+	 * Returns whether tracing is currently suspended by Significance Provider.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	bool IsSuspendedBySignificance() const
+	{ return bSuspendedBySignificance; };
+
+	/**
+	 * Returns whether traces are processed asynchronously.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	virtual bool GetUseAsyncTrace() const;
+	/**
+	 * Sets whether traces are processed asynchronously.
+	 * Pending async trace, if any, is discarded.
+	 *
+	 * @param bUse	Value to be set
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	virtual void SetUseAsyncTrace(const bool bUse);
+
 	/**
 	 * Returns transient Tracing Data.
 	 * Structure of all Tracing Data at one place.
@@ -257,6 +515,10 @@ protected:
 	
 	virtual bool CanInteract() const override;
 	virtual void SetState(const EInteractorStateV2 NewState) override;
+
+	virtual void AddIgnoredActor(AActor* IgnoredActor) override;
+	virtual void RemoveIgnoredActor(AActor* UnignoredActor) override;
+	virtual void SetResponseChannel(const ECollisionChannel NewResponseChannel) override;
 	
 	UFUNCTION(BlueprintImplementableEvent, Category="Interaction")
 	void OnTraceDataChangedEvent(const FTracingData& NewType, const FTracingData& OldType);
@@ -267,6 +529,7 @@ protected:
 	 * Defines how precise the interaction is.
 	 * - Loose Tracing is using BoxTrace and does not require precision.
 	 * - Precise Tracing is using LineTrace and requires higher precision. Useful with smaller objects.
+	 * - Spatial Tracing is searching registered Interactables in view cone. Useful in large levels with sparse Interactables.
 	 */
 	UPROPERTY(EditAnywhere, Category="Interaction|Required")
 	ETraceType TraceType;
@@ -274,6 +537,7 @@ protected:
 	/**
 	 * Optimization feature.
 	 * The frequency in seconds at which the Interaction function will be executed.
+	 * Traces of all Interactors are scheduled and batched by Trace Subsystem.
 	 *
 	 * Min value is 0.01 (1e-2)
 	 * Higher the value, less frequent tracing is and less performance is required.
@@ -298,11 +562,106 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Interaction|Required", meta=(Units = "cm", UIMin=0.1f, ClampMin=0.1f))
 	float TraceShapeHalfSize = 5.0f;
 	
+	/**
+	 * Half angle of view cone in degrees used by Spatial Tracing.
+	 * Interactables outside of this cone are not considered.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Required", meta=(Units = "deg", UIMin=0.1f, ClampMin=0.1f, UIMax=90.f, ClampMax=90.f, EditCondition="TraceType==ETraceType::ETT_Spatial", EditConditionHides))
+	float SpatialConeHalfAngle;
+
+	/**
+	 * How many best candidates found by Spatial Tracing are confirmed with line of sight Line Trace.
+	 * Each confirmation is one Line Trace.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Required", meta=(UIMin=1, ClampMin=1, EditCondition="TraceType==ETraceType::ETT_Spatial", EditConditionHides))
+	int32 SpatialMaxConfirmations;
+
 	/**
 	 * Defines whether Tracing starts at ActorEyesViewPoint (default) or at a given Location.
 	 */
 	UPROPERTY(EditAnywhere, Category="Interaction|Required")
 	uint8 bUseCustomStartTransform : 1;
+
+	/**
+	 * Optimization feature.
+	 * Defines whether Trace Interval is stretched while trace viewpoint does not move.
+	 * 
+	 * Every trace with viewpoint still doubles the interval, up to Adaptive Max Trace Interval.
+	 * Once viewpoint moves more than thresholds allow, tracing snaps back to Trace Interval immediately.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional")
+	uint8 bUseAdaptiveTraceInterval : 1;
+
+	/**
+	 * Viewpoint location change in cm under which viewpoint is considered still.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(Units = "cm", UIMin=0, ClampMin=0, EditCondition="bUseAdaptiveTraceInterval"))
+	float AdaptiveLocationThreshold;
+
+	/**
+	 * Viewpoint rotation change in degrees under which viewpoint is considered still.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(Units = "deg", UIMin=0, ClampMin=0, EditCondition="bUseAdaptiveTraceInterval"))
+	float AdaptiveRotationThreshold;
+
+	/**
+	 * Longest interval in seconds Trace Interval can be stretched to.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(Units = "s", UIMin=0.01f, ClampMin=0.01f, EditCondition="bUseAdaptiveTraceInterval"))
+	float AdaptiveMaxTraceInterval;
+
+	/**
+	 * Optimization feature.
+	 * Defines whether Precise/Loose tracing returns only first blocking hit, queried by Object Type instead of Channel.
+	 * Physics then stops at first hit and no hits need to be compared by weight.
+	 * 
+	 * Requires Collision Components of Interactables to use Interactable Object Channel as their Object Type.
+	 * Only first hit is considered, so Interactable Weight cannot prefer Interactable hidden behind another one.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional")
+	uint8 bUseSingleHitTrace : 1;
+
+	/**
+	 * Object Type dedicated to Collision Components of Interactables.
+	 * Suggested use is to create new Object Channel in Project Settings, like "Interactable".
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="bUseSingleHitTrace"))
+	TEnumAsByte<ECollisionChannel> InteractableObjectChannel;
+
+	/**
+	 * Defines whether World Static and World Dynamic objects are queried as well, so they block line of sight to Interactables.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional", meta=(EditCondition="bUseSingleHitTrace"))
+	uint8 bSingleHitBlockedByWorld : 1;
+
+	/**
+	 * Optimization feature.
+	 * Defines which features are requested from physics by traces.
+	 * Every extra feature costs additional work per hit, defaults are the cheapest set needed to select Interactables.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional")
+	FInteractionTraceQueryProfile TraceQueryProfile;
+
+	/**
+	 * Optimization feature.
+	 * Optional policy selecting trace-rate tier based on distance to nearest player view, visibility and possession.
+	 * Useful for AI Interactors, so CPU cost scales with relevant Interactors rather than with all of them.
+	 * 
+	 * If not set, Interactor always traces at its own Trace Interval.
+	 */
+	UPROPERTY(EditAnywhere, Instanced, Category="Interaction|Optional")
+	UInteractionSignificanceProvider* SignificanceProvider;
+
+	/**
+	 * Optimization feature.
+	 * Defines whether Precise/Loose tracing uses physics async query API instead of blocking Game Thread.
+	 * 
+	 * Trace is submitted when Trace Interval elapses and its results are consumed at the beginning of next frame,
+	 * so selection of Interactables is delayed by exactly one frame.
+	 * No new trace is submitted while previous one is still pending.
+	 */
+	UPROPERTY(EditAnywhere, Category="Interaction|Optional")
+	uint8 bUseAsyncTrace : 1;
 	
 	/**
 	 * Transform in World Space.
@@ -323,11 +682,61 @@ protected:
 	FTracingData LastTracingData;
 
 	/**
-	 * Timer Handle.
-	 * Won't display any values in Blueprints.
+	 * Trace Interval currently used for scheduling.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, Category="Interaction|Read Only")
+	float EffectiveTraceInterval;
+
+	/**
+	 * Trace Interval of trace-rate tier selected by Significance Provider.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, Category="Interaction|Read Only")
+	float SignificanceTraceInterval;
+
+	/**
+	 * Set when tracing was paused by Significance Provider, so only such pause is resumed by it.
+	 */
+	uint8 bSuspendedBySignificance : 1;
+
+	FVector LastTraceViewpointLocation;
+	FRotator LastTraceViewpointRotation;
+	uint8 bHasLastTraceViewpoint : 1;
+
+	/**
+	 * Trace Data reused by every trace.
+	 * Hit Results keep their capacity between traces, so no heap allocations are made once buffer is warmed up.
+	 */
+	FInteractionTraceDataV2 TraceBuffer;
+	/**
+	 * Candidates found by Spatial Tracing.
+	 */
+	TArray<UActorInteractableComponentBase*> SpatialCandidates;
+	/**
+	 * Interactables found for Collision Component which is not registered in Interactable Registry.
+	 */
+	FInteractableList UnregisteredHitInteractables;
+
+	/**
+	 * Collision Params shared by all traces.
+	 */
+	FCollisionQueryParams CachedCollisionParams;
+	/**
+	 * Object Query Params shared by all Single Hit traces.
+	 */
+	FCollisionObjectQueryParams CachedObjectQueryParams;
+	/**
+	 * Set when Ignored Actors, Response Channel or Trace Query Profile changed and cached Collision Params must be rebuilt.
+	 */
+	uint8 bCollisionParamsDirty : 1;
+
+	/**
+	 * Handle of async trace which results are not consumed yet.
+	 */
+	FTraceHandle AsyncTraceHandle;
+	/**
+	 * Delegate called by World once async trace is done.
 	 */
-	UPROPERTY(VisibleAnywhere, Category="Interaction|Read Only")
-	FTimerHandle Timer_Ticking;
+	FTraceDelegate AsyncTraceDelegate;
 
 protected:
 
@@ -0,0 +1,104 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+
+#include "Helpers/InteractionHelpers.h"
+
+#include "ActorInteractableDefinition.generated.h"
+
+/**
+ * Actor Interactable Definition
+ *
+ * Primary Data Asset holding configuration shared by many Interactables, like identical crates or pickups in a level.
+ * Interactables referencing Definition read its values instead of keeping their own copy,
+ * unless given value is overridden on Interactable instance.
+ *
+ * Definition is never modified at runtime.
+ */
+UCLASS(BlueprintType, ClassGroup=(Interaction), meta=(DisplayName = "Interactable Definition"))
+class ACTORINTERACTIONPLUGIN_API UActorInteractableDefinition : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	UActorInteractableDefinition();
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	FText GetInteractableName() const
+	{ return InteractableName; };
+
+	float GetInteractionPeriod() const
+	{ return InteractionPeriod; };
+
+	EInteractableLifecycle GetLifecycleMode() const
+	{ return LifecycleMode; };
+
+	int32 GetLifecycleCount() const
+	{ return LifecycleCount; };
+
+	float GetCooldownPeriod() const
+	{ return CooldownPeriod; };
+
+	const TMap<FString, FInteractionKeySetup>& GetInteractionKeysPerPlatform() const
+	{ return InteractionKeysPerPlatform; };
+
+	const TArray<TSoftClassPtr<UObject>>& GetIgnoredClasses() const
+	{ return IgnoredClasses; };
+
+protected:
+
+	/**
+	 * Display Name.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	FText InteractableName;
+
+	/**
+	 * Defines how long does Interaction take.
+	 * - -1 = immediate
+	 * - 0  = 0.1s
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(UIMin=-1, ClampMin=-1, Units="seconds"))
+	float InteractionPeriod;
+
+	/**
+	 * Defines Lifecycle Mode of Interactables using this Definition.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	EInteractableLifecycle LifecycleMode;
+
+	/**
+	 * How many times Interactables using this Definition can be used.
+	 * * -1 | Can be used forever
+	 * * 2+ | Will be used defined number of times
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(EditCondition = "LifecycleMode == EInteractableLifecycle::EIL_Cycled", UIMin=-1, ClampMin=-1, Units="times"))
+	int32 LifecycleCount;
+
+	/**
+	 * How long it takes for Cooldown to finish.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(EditCondition = "LifecycleMode == EInteractableLifecycle::EIL_Cycled", UIMin=0.1, ClampMin=0.1, Units="Seconds"))
+	float CooldownPeriod;
+
+	/**
+	 * List of Interaction Keys for each platform.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Optional")
+	TMap<FString, FInteractionKeySetup> InteractionKeysPerPlatform;
+
+	/**
+	 * List of Interactor Classes which are ignored.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Optional", meta=(AllowAbstract=false, MustImplement="/Script/ActorInteractionPlugin.ActorInteractorInterface", BlueprintBaseOnly))
+	TArray<TSoftClassPtr<UObject>> IgnoredClasses;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
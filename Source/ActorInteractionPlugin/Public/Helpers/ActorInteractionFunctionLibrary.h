@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ActorInteractionPlugin.h"
 #include "ActorInteractionPluginLog.h"
 #include "ActorInteractionPluginSettings.h"
 #include "Blueprint/UserWidget.h"
@@ -40,36 +41,48 @@ public:
 		return 0.05f;
 	}
 
+	/**
+	 * Returns Default Interactable Data Table.
+	 * Blocks only if requested before async loading of Defaults has finished.
+	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction", meta=(CompactNodeTitle="Default Interactable Data"))
-	static UDataTable* GetInteractableDefaultDataTable()
-	{
-		const UActorInteractionPluginSettings* Settings = GetMutableDefault<UActorInteractionPluginSettings>();
+	static UDataTable* GetInteractableDefaultDataTable();
 
-		if (Settings)
-		{
-			if (const auto FoundTable = Settings->GetInteractableDefaultDataTable().LoadSynchronous())
-			{
-				return FoundTable;
-			}
-		}
+	/**
+	 * Returns Default Interactable Widget Class.
+	 * Blocks only if requested before async loading of Defaults has finished.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction", meta=(CompactNodeTitle="Default Interactable Data"))
+	static TSubclassOf<UUserWidget> GetInteractableDefaultWidgetClass();
 
-		AIntP_LOG(Error, TEXT("[GetInteractableDefaultDataTable] Cannot load ActorInteractionPluginSettings! Using null value."))
-		return nullptr;
+	/**
+	 * Returns Default Interactable Data Table only if it has been loaded already.
+	 * Never blocks, returns null while Defaults are still loading.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction")
+	static UDataTable* GetLoadedInteractableDefaultDataTable()
+	{
+		return FActorInteractionPluginModule::IsAvailable() ? FActorInteractionPluginModule::Get().GetLoadedDefaultDataTable() : nullptr;
 	}
 
-	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction", meta=(CompactNodeTitle="Default Interactable Data"))
-	static TSubclassOf<UUserWidget> GetInteractableDefaultWidgetClass()
+	/**
+	 * Returns Default Interactable Widget Class only if it has been loaded already.
+	 * Never blocks, returns null while Defaults are still loading.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction")
+	static TSubclassOf<UUserWidget> GetLoadedInteractableDefaultWidgetClass()
 	{
-		const UActorInteractionPluginSettings* Settings = GetMutableDefault<UActorInteractionPluginSettings>();
+		return FActorInteractionPluginModule::IsAvailable() ? FActorInteractionPluginModule::Get().GetLoadedDefaultWidgetClass() : nullptr;
+	}
 
-		if (Settings)
-		{
-			const TSubclassOf<UUserWidget> WidgetClass = Settings->GetInteractableDefaultWidgetClass().LoadSynchronous();
-			return WidgetClass;
-		}
-		
-		AIntP_LOG(Error, TEXT("[GetInteractableDefaultWidgetClass] Cannot load ActorInteractionPluginSettings! Using null value."))
-		return nullptr;
+	/**
+	 * Returns whether async loading of Default Data Table and Default Widget Class has finished.
+	 * Blueprint can wait for them with Wait For Interactable Defaults, native code can bind to FActorInteractionPluginModule::OnDefaultsLoaded.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction")
+	static bool AreInteractableDefaultsLoaded()
+	{
+		return FActorInteractionPluginModule::IsAvailable() && FActorInteractionPluginModule::Get().AreDefaultsLoaded();
 	}
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction", meta=(CompactNodeTitle="Default Interactable Data"))
@@ -28,19 +28,23 @@ class ACTORINTERACTIONPLUGIN_API UActorInteractionPluginSettings : public UDevel
 	UPROPERTY(config, EditAnywhere, Category="Editor")
 	uint8 bEditorDebugEnabled : 1;
 
-	/* Defines how often is the Interaction widget updated per second.*/
+	/* Defines how often is the Interaction widget updated per second.
+	 * Only used by legacy Interactable Component, Interactables based on Interactable Component Base push Widget updates once their data changes.*/
 	UPROPERTY(config, EditAnywhere, Category = "Widgets", meta=(Units="s", UIMin=0.001, ClampMin=0.001, ConfigRestartRequired = true))
 	float WidgetUpdateFrequency = 0.05f;
 
 	/* Defines default Interactable Widget class.*/
-	UPROPERTY(config, EditAnywhere, Category = "Widgets", meta=(AllowedClasses="UserWidget", MustImplement="/Script/ActorInteractionPlugin.ActorInteractionWidget", ConfigRestartRequired = true))
+	UPROPERTY(config, EditAnywhere, Category = "Widgets", meta=(AllowedClasses="UserWidget", MustImplement="/Script/ActorInteractionPlugin.ActorInteractionWidget"))
 	TSoftClassPtr<UUserWidget>InteractableDefaultWidgetClass;
 	
 	/* Defines default DataTable which contains Interactable data values.*/
-	UPROPERTY(config, EditAnywhere, Category = "Interaction Data", meta=(AllowedClasses = "DataTable", ConfigRestartRequired = true))
+	UPROPERTY(config, EditAnywhere, Category = "Interaction Data", meta=(AllowedClasses = "DataTable"))
 	TSoftObjectPtr<UDataTable> InteractableDefaultDataTable;
 	
 #if WITH_EDITOR
+	/* Reloads Defaults once Default Widget Class or Default Data Table is changed.*/
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
 	virtual FText GetSectionText() const override
 	{
 		return NSLOCTEXT("ActorInteractionPlugin", "MounteaSettingsDescription", "Actor Interaction Plugin");
@@ -0,0 +1,19 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Stat group used by all runtime Interaction systems.
+ * Use `stat MounteaInteraction` to display values in game.
+ */
+DECLARE_STATS_GROUP(TEXT("MounteaInteraction"), STATGROUP_MounteaInteraction, STATCAT_Advanced);
+
+/**
+ * Low Level Memory tag of Trace Interactors.
+ * Use `-llm` and `stat LLMFULL` to confirm tracing makes no heap allocations in steady state.
+ */
+LLM_DECLARE_TAG_API(MounteaInteraction_Trace, ACTORINTERACTIONPLUGIN_API);
@@ -0,0 +1,42 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "ActorInteractionWaitForDefaults.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FInteractableDefaultsLoaded);
+
+/**
+ * Waits until Default Data Table and Default Widget Class have been loaded.
+ * Blueprint counterpart of FActorInteractionPluginModule::OnDefaultsLoaded.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UActorInteractionWaitForDefaults : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Calls On Loaded once Interactable Defaults are loaded, or right away if they are loaded already.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction", meta=(BlueprintInternalUseOnly="true", WorldContext="WorldContextObject"))
+	static UActorInteractionWaitForDefaults* WaitForInteractableDefaults(UObject* WorldContextObject);
+
+	virtual void Activate() override;
+
+public:
+
+	UPROPERTY(BlueprintAssignable)
+	FInteractableDefaultsLoaded OnLoaded;
+
+private:
+
+	void HandleDefaultsLoaded();
+
+private:
+
+	FDelegateHandle DefaultsLoadedHandle;
+};
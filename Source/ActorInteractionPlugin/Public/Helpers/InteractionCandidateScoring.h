@@ -0,0 +1,172 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/Interface.h"
+#include "InteractionCandidateScoring.generated.h"
+
+class IActorInteractableInterface;
+
+/**
+ * One ranked Interactable exposed by Interactor.
+ */
+USTRUCT(BlueprintType)
+struct FInteractionCandidate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Category="Interaction|FInteractionCandidate", VisibleAnywhere, BlueprintReadOnly)
+	TScriptInterface<IActorInteractableInterface> Interactable;
+	UPROPERTY(Category="Interaction|FInteractionCandidate", VisibleAnywhere, BlueprintReadOnly)
+	float Score;
+
+	FInteractionCandidate() :
+	Interactable(nullptr),
+	Score(0.f)
+	{};
+
+	FInteractionCandidate(const TScriptInterface<IActorInteractableInterface>& NewInteractable, const float NewScore) :
+	Interactable(NewInteractable),
+	Score(NewScore)
+	{};
+
+	// Candidates are same if they reference same Interactable, Score is not compared
+	bool operator==(const FInteractionCandidate& Other) const
+	{ return Interactable == Other.Interactable; };
+};
+
+/**
+ * Interactables competing for selection in one Interactor pass.
+ *
+ * Inputs are stored as structure of arrays, so Scoring Policies can score four candidates at once using VectorRegister math.
+ * Before scoring, input arrays are padded with neutral values to multiple of 4, therefore padded tail must be ignored.
+ */
+struct ACTORINTERACTIONPLUGIN_API FInteractionCandidateSoA
+{
+	// Candidate Interactables, never padded
+	TArray<TScriptInterface<IActorInteractableInterface>> Interactables;
+	// Index of source entry, like Hit Result, candidate was gathered from
+	TArray<int32> SourceIndices;
+
+	// Distance in cm from Interactor viewpoint
+	TArray<float> Distances;
+	// Cosine of angle between Interactor view direction and direction to candidate
+	TArray<float> ViewDots;
+	// Interactable Weight
+	TArray<float> Weights;
+	// Seconds since candidate was interacted with, large if never
+	TArray<float> TimesSinceInteraction;
+
+	// Output of scoring, same length as padded inputs
+	TArray<float> Scores;
+
+	void Reset();
+
+	/**
+	 * Appends new candidate.
+	 *
+	 * @return	Index of new candidate.
+	 */
+	int32 Add(const TScriptInterface<IActorInteractableInterface>& Interactable, const int32 SourceIndex, const float Distance, const float ViewDot, const float TimeSinceInteraction);
+
+	/**
+	 * Pads input arrays to multiple of 4 and sizes Scores to match.
+	 */
+	void Pad();
+
+	/**
+	 * Returns index of candidate with highest Score, first one wins ties.
+	 * INDEX_NONE if there is no candidate.
+	 */
+	int32 FindBest() const;
+
+	int32 Num() const
+	{ return Interactables.Num(); };
+
+	int32 NumPadded() const
+	{ return Distances.Num(); };
+
+	int32 Find(const TScriptInterface<IActorInteractableInterface>& Interactable) const
+	{ return Interactables.Find(Interactable); };
+};
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
+class UInteractionScoringPolicy : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Scoring Policy used by Interactors to rank candidates.
+ * Highest score wins, first candidate wins ties.
+ */
+class ACTORINTERACTIONPLUGIN_API IInteractionScoringPolicy
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Fills Scores for all candidates in single pass.
+	 * Candidates are already padded to multiple of 4.
+	 *
+	 * @param Candidates	Candidates to be scored.
+	 */
+	virtual void ScoreCandidates(FInteractionCandidateSoA& Candidates) const = 0;
+};
+
+/**
+ * Interaction Scoring Weights
+ *
+ * Data Asset configuring default Scoring Policy.
+ * Score is weighted sum of:
+ * * Interactable Weight
+ * * Proximity, 1 at Interactor and 0 at Max Distance
+ * * View alignment, 1 in view direction and -1 behind
+ * * Freshness, 0 right after interaction and 1 once Freshness Period passes
+ *
+ * With default values Score equals Interactable Weight.
+ */
+UCLASS(BlueprintType, ClassGroup=(Interaction), meta=(DisplayName = "Interaction Scoring Weights"))
+class ACTORINTERACTIONPLUGIN_API UInteractionScoringWeights : public UDataAsset, public IInteractionScoringPolicy
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionScoringWeights();
+
+	virtual void ScoreCandidates(FInteractionCandidateSoA& Candidates) const override;
+
+protected:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	float InteractableWeightFactor;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	float ProximityFactor;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	float ViewAlignmentFactor;
+
+	/**
+	 * Negative value prefers recently used Interactables.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	float FreshnessFactor;
+
+	/**
+	 * Distance at which Proximity reaches 0.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(Units = "cm", UIMin=1, ClampMin=1))
+	float MaxDistance;
+
+	/**
+	 * Time after interaction at which Freshness reaches 1.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(Units = "s", UIMin=0.01f, ClampMin=0.01f))
+	float FreshnessPeriod;
+};
@@ -58,6 +58,53 @@ enum class EInteractableLifecycle : uint8
   Default      UMETA(Hidden)
 };
 
+/**
+ * Interactor Arbitration.
+ *
+ * Defines which Interactor gets the slot once Interactable already serves Max Concurrent Interactors.
+ */
+UENUM(BlueprintType)
+enum class EInteractorArbitration : uint8
+{
+  EIA_ReplaceOldest  UMETA(DisplayName="Replace Oldest", Tooltip="New Interactor replaces Interactor which was found first, or next oldest one while first is interacting. With single slot this is how Interactables always behaved."),
+  EIA_ReplaceIdle    UMETA(DisplayName="Replace Idle", Tooltip="New Interactor replaces oldest Interactor which is not interacting. Rejected if all Interactors are interacting."),
+  EIA_KeepExisting   UMETA(DisplayName="Keep Existing", Tooltip="New Interactors are rejected until any slot is released."),
+
+  Default            UMETA(Hidden)
+};
+
+/**
+ * Interactable Prompt Mode.
+ * 
+ * Defines how Interactable displays its Widget.
+ */
+UENUM(BlueprintType)
+enum class EInteractablePromptMode : uint8
+{
+  EIPM_WidgetComponent  UMETA(DisplayName="Widget Component", Tooltip="Interactable creates and owns its Widget. This is how Interactables always behaved."),
+  EIPM_Pooled           UMETA(DisplayName="Pooled", Tooltip="Interactable creates no Widget. Prompt Subsystem of Local Player shows pooled Widget of Widget Class once Interactable is found."),
+  EIPM_Batched          UMETA(DisplayName="Batched", Tooltip="Interactable creates no Widget. Prompt Subsystem of Local Player paints Key, Name and Progress of all batched Interactables in single Slate Prompt Layer. Widget Class is ignored."),
+
+  Default               UMETA(Hidden)
+};
+
+/**
+ * Parts of Interactable Widget which have changed since Widget was last updated.
+ * Interactables push Widget updates only once any of these is marked dirty.
+ */
+enum class EInteractableWidgetDirty : uint8
+{
+  None      = 0,
+  State     = 1 << 0,
+  Key       = 1 << 1,
+  Name      = 1 << 2,
+  // Progress was started, paused, reset or its rate has changed
+  Progress  = 1 << 3,
+
+  All       = State | Key | Name | Progress
+};
+ENUM_CLASS_FLAGS(EInteractableWidgetDirty)
+
 /**
  * Type of Interactor Actor Component.
  * 
@@ -0,0 +1,83 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+
+struct FInteractionKeySetup;
+
+/**
+ * Interaction Key Table
+ *
+ * Process wide table of Interaction Key sets for the running platform.
+ * Per-platform Key maps are resolved once, when Interactable begins play, and identical Key sets are shared.
+ * Interactables then keep only index of their Key set, so Key lookups do not search per-platform maps by platform name.
+ *
+ * Key set at index 0 is always empty.
+ * Table is only modified on Game Thread.
+ */
+class ACTORINTERACTIONPLUGIN_API FInteractionKeyTable
+{
+public:
+
+	static FInteractionKeyTable& Get();
+
+	/**
+	 * Returns name of running platform, as used in Interaction Keys per platform.
+	 */
+	const FString& GetRunningPlatformName() const
+	{ return RunningPlatformName; };
+
+	/**
+	 * Returns running platform interned as Name.
+	 */
+	FName GetRunningPlatform() const
+	{ return RunningPlatform; };
+
+	/**
+	 * Returns whether given platform is the running platform, without any string comparison or hashing.
+	 */
+	bool IsRunningPlatform(const FName PlatformName) const
+	{ return PlatformName == RunningPlatform; };
+	/**
+	 * Returns whether given platform name is the running platform.
+	 * Name is looked up in Name table, so C++ callers should prefer the Name overload.
+	 */
+	bool IsRunningPlatform(const FString& PlatformName) const;
+
+	/**
+	 * Returns index of Key set of running platform found in given per-platform map.
+	 * Key set is added to table unless identical one already exists.
+	 *
+	 * @param KeysPerPlatform		Interaction Keys per platform.
+	 * @return Index of Key set, 0 if there are no Keys for running platform.
+	 */
+	int32 FindOrAddKeySet(const TMap<FString, FInteractionKeySetup>& KeysPerPlatform);
+
+	/**
+	 * Returns Keys of given Key set.
+	 * Reference is only valid until another Key set is added.
+	 */
+	const TArray<FKey>& GetKeys(const int32 KeySetIndex) const;
+
+	/**
+	 * Returns whether given Key set contains Key.
+	 */
+	bool ContainsKey(const int32 KeySetIndex, const FKey& Key) const;
+
+	int32 Num() const
+	{ return KeySets.Num(); };
+
+private:
+
+	FInteractionKeyTable();
+
+private:
+
+	FString RunningPlatformName;
+
+	FName RunningPlatform;
+
+	TArray<TArray<FKey>> KeySets;
+};
@@ -0,0 +1,140 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "InteractionSignificanceProvider.generated.h"
+
+class UActorInteractorComponentTrace;
+
+/**
+ * Inputs describing how relevant Interactor is for local or remote players.
+ */
+USTRUCT(BlueprintType)
+struct FInteractionSignificance
+{
+	GENERATED_BODY()
+
+	/**
+	 * Distance in cm from Interactor Owner to nearest player view.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionSignificance", VisibleAnywhere, BlueprintReadWrite, meta=(Units = "cm"))
+	float DistanceToNearestView;
+	/**
+	 * Whether Interactor Owner was recently rendered or is inside any player view cone.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionSignificance", VisibleAnywhere, BlueprintReadWrite)
+	uint8 bOnScreen : 1;
+	/**
+	 * Whether Interactor Owner is possessed by player.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionSignificance", VisibleAnywhere, BlueprintReadWrite)
+	uint8 bPossessedByPlayer : 1;
+
+	FInteractionSignificance() :
+	DistanceToNearestView(TNumericLimits<float>::Max()),
+	bOnScreen(false),
+	bPossessedByPlayer(false)
+	{};
+};
+
+/**
+ * One trace-rate tier.
+ */
+USTRUCT(BlueprintType)
+struct FInteractionTraceTier
+{
+	GENERATED_BODY()
+
+	/**
+	 * Tier is used when Interactor is closer to nearest player view than this distance.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceTier", EditAnywhere, BlueprintReadWrite, meta=(Units = "cm", UIMin=0, ClampMin=0))
+	float MaxDistance;
+	/**
+	 * Trace Interval in seconds used in this tier.
+	 * Interactor never traces more frequently than its own Trace Interval.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceTier", EditAnywhere, BlueprintReadWrite, meta=(Units = "s", UIMin=0.01f, ClampMin=0.01f))
+	float TraceInterval;
+	/**
+	 * Whether tracing is suspended completely in this tier.
+	 */
+	UPROPERTY(Category="Interaction|FInteractionTraceTier", EditAnywhere, BlueprintReadWrite)
+	uint8 bSuspendTracing : 1;
+
+	FInteractionTraceTier() :
+	MaxDistance(0.f),
+	TraceInterval(0.01f),
+	bSuspendTracing(false)
+	{};
+
+	FInteractionTraceTier(const float NewMaxDistance, const float NewTraceInterval, const bool bSuspend) :
+	MaxDistance(NewMaxDistance),
+	TraceInterval(NewTraceInterval),
+	bSuspendTracing(bSuspend)
+	{};
+};
+
+/**
+ * Interaction Significance Provider
+ *
+ * Optional policy for Trace Interactors selecting trace-rate tier based on how relevant Interactor is for players.
+ * Interactors possessed by players always trace at their own Trace Interval.
+ * Other Interactors use first tier which Max Distance is larger than distance to nearest player view.
+ * Beyond last tier tracing is suspended.
+ *
+ * Evaluated periodically by Trace Subsystem, see `Mountea.Interaction.SignificanceUpdateInterval`.
+ * Can be extended both in C++ and Blueprints.
+ */
+UCLASS(Blueprintable, BlueprintType, EditInlineNew, DefaultToInstanced, ClassGroup=(Interaction), meta=(DisplayName = "Interaction Significance Provider"))
+class ACTORINTERACTIONPLUGIN_API UInteractionSignificanceProvider : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionSignificanceProvider();
+
+	/**
+	 * Collects significance inputs for given Interactor.
+	 *
+	 * @param Interactor	Interactor to be evaluated.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Interaction")
+	FInteractionSignificance EvaluateSignificance(const UActorInteractorComponentTrace* Interactor) const;
+	virtual FInteractionSignificance EvaluateSignificance_Implementation(const UActorInteractorComponentTrace* Interactor) const;
+
+	/**
+	 * Selects trace-rate tier for given significance.
+	 *
+	 * @param Significance	Inputs collected by EvaluateSignificance.
+	 * @return				Selected tier. Tier with zero Max Distance and no suspension means full rate.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Interaction")
+	FInteractionTraceTier SelectTraceTier(const FInteractionSignificance& Significance) const;
+	virtual FInteractionTraceTier SelectTraceTier_Implementation(const FInteractionSignificance& Significance) const;
+
+protected:
+
+	/**
+	 * Trace-rate tiers ordered from closest to furthest.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required")
+	TArray<FInteractionTraceTier> TraceTiers;
+
+	/**
+	 * Distance to nearest player view is multiplied by this value if Interactor is not on screen.
+	 * Higher the value, sooner off-screen Interactors fall to slower tiers.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(UIMin=1, ClampMin=1))
+	float OffScreenDistanceMultiplier;
+
+	/**
+	 * Half angle of player view cone in degrees, used to estimate whether Interactor is on screen
+	 * where rendering information is not available, like on dedicated servers.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Required", meta=(Units = "deg", UIMin=1, ClampMin=1, UIMax=180, ClampMax=180))
+	float ViewHalfAngle;
+};
@@ -46,6 +46,7 @@ class IActorInteractableInterface;
 class IActorInteractorInterface;
 
 struct FDataTableRowHandle;
+struct FInteractionTimerHandle;
 
 enum class EInteractableStateV2 : uint8;
 enum class EInteractableLifecycle : uint8;
@@ -66,29 +67,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FInteractionStarted, const float&
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FInteractionStopped, const float&, StartTime, const FKey&, PressedKey, const TScriptInterface<IActorInteractorInterface>&, CausingInteractor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FInteractionCanceled);
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE(FLifecycleCompleted);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE(FCooldownCompleted);
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableDependencyChanged, const TScriptInterface<IActorInteractableInterface>&, ChagnedDependency);
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableAutoSetupChanged, const bool, NewValue);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableWeightChanged, const int32&, NewWeight);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableStateChanged, const EInteractableStateV2&, NewState);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableOwnerChanged, const AActor*, NewOwner);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableCollisionChannelChanged, const ECollisionChannel, NewCollisionChannel);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLifecycleModeChanged, const EInteractableLifecycle&, NewMode);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLifecycleCountChanged, const int32, NewLifecycleCount);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCooldownPeriodChanged, const float, NewCooldownPeriod);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractorChanged, const TScriptInterface<IActorInteractorInterface>&, NewInteractor);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FIgnoredInteractorClassAdded, const TSoftClassPtr<UObject>&, IgnoredClass);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FIgnoredInteractorClassRemoved, const TSoftClassPtr<UObject>&, IgnoredClass);
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FHighlightableComponentAdded, const UMeshComponent*, NewHighlightableComp);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionComponentAdded, const UPrimitiveComponent*, NewCollisionComp);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FHighlightableComponentRemoved, const UMeshComponent*, RemovedHighlightableComp);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionComponentRemoved, const UPrimitiveComponent*, RemovedCollisionComp);
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableDependencyStarted, const TScriptInterface<IActorInteractableInterface>&, NewMaster);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableDependencyStopped, const TScriptInterface<IActorInteractableInterface>&, FormerMaster);
 
@@ -255,6 +240,10 @@ public:
 	virtual int32 GetInteractableWeight() const = 0;
 	virtual void SetInteractableWeight(const int32 NewWeight) = 0;
 
+	// World time of last completed interaction, -1 if never interacted with
+	virtual float GetLastInteractionTime() const
+	{ return -1.f; };
+
 	virtual AActor* GetInteractableOwner() const = 0;
 	virtual void SetInteractableOwner(AActor* NewOwner) = 0;
 
@@ -357,6 +346,6 @@ public:
 	virtual FInteractableDependencyStarted& GetInteractableDependencyStarted() = 0;
 	virtual FInteractableDependencyStopped& GetInteractableDependencyStopped() = 0;
 
-	virtual FTimerHandle& GetCooldownHandle() = 0;
+	virtual FInteractionTimerHandle& GetCooldownHandle() = 0;
 	virtual FInteractableStateChanged& GetInteractableStateChanged() = 0;
 };
\ No newline at end of file
@@ -91,4 +91,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category="Interaction")
 	float GetProgress() const;
+
+	/**
+	 * Called once Interaction Progress starts, pauses, resets or changes its rate.
+	 * Widget should interpolate displayed progress locally as `Progress + (WorldTime - Timestamp) * ProgressRate`
+	 * instead of asking Interactable for progress every frame.
+	 * 
+	 * @param Timestamp		World Time at which Progress was sampled.
+	 * @param Progress		Interaction Progress at Timestamp.
+	 * @param ProgressRate	Progress gained each second, 0 while progress is not running.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category="Interaction")
+	void SetProgressTiming(const float Timestamp, const float Progress, const float ProgressRate);
 };
@@ -0,0 +1,229 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ActorInteractableRegistrySubsystem.generated.h"
+
+class UPrimitiveComponent;
+class UActorInteractableComponentBase;
+class IActorInteractableInterface;
+
+/**
+ * List of Interactables using one Collision Component.
+ * Most Collision Components are used by single Interactable, therefore inline storage is used.
+ */
+typedef TArray<TWeakObjectPtr<UObject>, TInlineAllocator<2>> FInteractableList;
+
+/**
+ * One Interactable stored in Spatial Hash.
+ */
+struct FInteractableSpatialEntry
+{
+	TWeakObjectPtr<UActorInteractableComponentBase> Interactable;
+	FVector Location;
+
+	FInteractableSpatialEntry() :
+	Location(FVector::ZeroVector)
+	{};
+
+	FInteractableSpatialEntry(UActorInteractableComponentBase* NewInteractable, const FVector& NewLocation) :
+	Interactable(NewInteractable),
+	Location(NewLocation)
+	{};
+};
+
+typedef TArray<FInteractableSpatialEntry, TInlineAllocator<4>> FInteractableSpatialCell;
+
+/**
+ * Actor Interactable Registry Subsystem
+ *
+ * World level registry of Interactables.
+ * Maps each Collision Component to Interactables which are using it, so Interactors can resolve hits
+ * with single hash lookup instead of iterating all Components of hit Actor.
+ *
+ * Maintained by Interactables when adding or removing Collision Components and in their BeginPlay.
+ * Custom implementations of IActorInteractableInterface should register their Collision Components manually,
+ * either from C++ or from Blueprints. Unregistered Collision Components are still found by Trace Interactors, only slower.
+ *
+ * Also keeps Spatial Hash of all Interactables in World, so candidates can be found by cheap math tests
+ * instead of physics queries against all geometry.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UActorInteractableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Registers Collision Component for given Interactable.
+	 *
+	 * @param CollisionComponent	Collision Component used by Interactable.
+	 * @param Interactable			Interactable using this Collision Component.
+	 */
+	void RegisterCollisionComponent(const UPrimitiveComponent* CollisionComponent, const TScriptInterface<IActorInteractableInterface>& Interactable);
+	/**
+	 * Unregisters Collision Component for given Interactable.
+	 * Once no Interactable is using Collision Component, it is removed from Registry.
+	 *
+	 * @param CollisionComponent	Collision Component used by Interactable.
+	 * @param Interactable			Interactable no longer using this Collision Component.
+	 */
+	void UnregisterCollisionComponent(const UPrimitiveComponent* CollisionComponent, const TScriptInterface<IActorInteractableInterface>& Interactable);
+	/**
+	 * Unregisters all Collision Components of given Interactable.
+	 *
+	 * @param Interactable			Interactable to be removed from Registry.
+	 */
+	void UnregisterInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable);
+
+	/**
+	 * Registers Collision Component for given Interactable.
+	 * Only needed for custom Interactables, Interactable Components register their Collision Components themselves.
+	 *
+	 * @param CollisionComponent	Collision Component used by Interactable.
+	 * @param Interactable			Interactable using this Collision Component.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction", meta=(DisplayName = "Register Interactable Collision Component"))
+	void K2_RegisterCollisionComponent(UPrimitiveComponent* CollisionComponent, const TScriptInterface<IActorInteractableInterface>& Interactable)
+	{ RegisterCollisionComponent(CollisionComponent, Interactable); };
+	/**
+	 * Unregisters Collision Component for given Interactable.
+	 *
+	 * @param CollisionComponent	Collision Component used by Interactable.
+	 * @param Interactable			Interactable no longer using this Collision Component.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction", meta=(DisplayName = "Unregister Interactable Collision Component"))
+	void K2_UnregisterCollisionComponent(UPrimitiveComponent* CollisionComponent, const TScriptInterface<IActorInteractableInterface>& Interactable)
+	{ UnregisterCollisionComponent(CollisionComponent, Interactable); };
+
+	/**
+	 * Returns Interactables using given Collision Component.
+	 * Might contain stale entries, validity must be checked by caller.
+	 *
+	 * @param CollisionComponent	Collision Component to search for.
+	 * @return						Null if no Interactable is using this Collision Component.
+	 */
+	const FInteractableList* FindInteractables(const UPrimitiveComponent* CollisionComponent) const
+	{ return CollisionToInteractables.Find(CollisionComponent); };
+
+	/**
+	 * Inserts Interactable into Spatial Hash at its current location.
+	 * If already inserted, its location is updated.
+	 *
+	 * @param Interactable			Interactable to be inserted.
+	 */
+	void RegisterSpatialInteractable(UActorInteractableComponentBase* Interactable);
+	/**
+	 * Removes Interactable from Spatial Hash.
+	 *
+	 * @param Interactable			Interactable to be removed.
+	 */
+	void UnregisterSpatialInteractable(const UActorInteractableComponentBase* Interactable);
+	/**
+	 * Moves Interactable to its current location in Spatial Hash.
+	 * Interactable which stays in same cell only updates its stored location.
+	 * Called by Movable Interactables whenever their transform is updated.
+	 *
+	 * @param Interactable			Interactable which has moved.
+	 */
+	void UpdateSpatialInteractable(UActorInteractableComponentBase* Interactable);
+
+	/**
+	 * Finds all Interactables within radius.
+	 * Found Interactables are appended to OutInteractables, which is not reset.
+	 *
+	 * @param Origin				Center of the sphere.
+	 * @param Radius				Radius of the sphere in cm.
+	 * @param OutInteractables		Array to be filled with found Interactables.
+	 */
+	void QueryRadius(const FVector& Origin, const float Radius, TArray<UActorInteractableComponentBase*>& OutInteractables) const;
+	/**
+	 * Finds all Interactables inside axis aligned box.
+	 * Found Interactables are appended to OutInteractables, which is not reset.
+	 *
+	 * @param Box					World space box to search in.
+	 * @param OutInteractables		Array to be filled with found Interactables.
+	 */
+	void QueryBox(const FBox& Box, TArray<UActorInteractableComponentBase*>& OutInteractables) const;
+	/**
+	 * Finds all Interactables inside view cone.
+	 * Found Interactables are appended to OutInteractables, which is not reset.
+	 *
+	 * @param Origin				Apex of the cone.
+	 * @param Direction				Normalized direction of the cone.
+	 * @param Range					Length of the cone in cm.
+	 * @param HalfAngle				Half angle of the cone in degrees.
+	 * @param OutInteractables		Array to be filled with found Interactables.
+	 */
+	void QueryCone(const FVector& Origin, const FVector& Direction, const float Range, const float HalfAngle, TArray<UActorInteractableComponentBase*>& OutInteractables) const;
+
+	/**
+	 * Returns all Interactables within Radius from Origin.
+	 * Uses Spatial Hash, no physics query is performed.
+	 *
+	 * @param Origin				Center of the sphere.
+	 * @param Radius				Radius of the sphere in cm.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction", meta=(DisplayName = "Find Interactables In Radius"))
+	TArray<UActorInteractableComponentBase*> K2_QueryRadius(const FVector& Origin, const float Radius) const;
+	/**
+	 * Returns all Interactables inside box defined by Center and Extent.
+	 * Uses Spatial Hash, no physics query is performed.
+	 *
+	 * @param Center				Center of the box.
+	 * @param Extent				Half size of the box in cm.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction", meta=(DisplayName = "Find Interactables In Box"))
+	TArray<UActorInteractableComponentBase*> K2_QueryBox(const FVector& Center, const FVector& Extent) const;
+	/**
+	 * Returns all Interactables inside cone.
+	 * Uses Spatial Hash, no physics query is performed.
+	 *
+	 * @param Origin				Apex of the cone.
+	 * @param Direction				Direction of the cone, does not need to be normalized.
+	 * @param Range					Length of the cone in cm.
+	 * @param HalfAngle				Half angle of the cone in degrees.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction", meta=(DisplayName = "Find Interactables In Cone"))
+	TArray<UActorInteractableComponentBase*> K2_QueryCone(const FVector& Origin, const FVector& Direction, const float Range, const float HalfAngle) const;
+
+	/**
+	 * Returns how many Interactables are stored in Spatial Hash.
+	 */
+	int32 GetNumSpatialInteractables() const
+	{ return InteractableCells.Num(); };
+
+	/**
+	 * Returns how many Collision Components are registered.
+	 */
+	int32 GetNumRegisteredCollisionComponents() const
+	{ return CollisionToInteractables.Num(); };
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	FIntVector GetCellCoordinates(const FVector& Location) const;
+
+	template<typename PredicateType>
+	void ForEachCellInBox(const FVector& Min, const FVector& Max, PredicateType Predicate) const;
+
+private:
+
+	TMap<TObjectKey<UPrimitiveComponent>, FInteractableList> CollisionToInteractables;
+
+	/**
+	 * Size of one Spatial Hash cell in cm.
+	 * Should be around typical Interaction range, so most queries touch only a few cells.
+	 */
+	float SpatialCellSize = 500.f;
+
+	TMap<FIntVector, FInteractableSpatialCell> SpatialCells;
+	TMap<TObjectKey<UActorInteractableComponentBase>, FIntVector> InteractableCells;
+};
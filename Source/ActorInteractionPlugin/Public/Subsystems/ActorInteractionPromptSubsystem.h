@@ -0,0 +1,162 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "Tickable.h"
+#include "ActorInteractionPromptSubsystem.generated.h"
+
+class UUserWidget;
+class UActorInteractableComponentBase;
+class SInteractionPromptLayer;
+
+/**
+ * Actor Interaction Prompt Subsystem
+ *
+ * Per Local Player Prompt Manager used by Interactables with Pooled Prompt Mode.
+ * Keeps one Widget per Widget Class and binds it to currently selected Interactable,
+ * so Interactables do not need to create their own Widgets.
+ *
+ * Pooled Widget is added to Player Screen and projected to location of bound Interactable every frame.
+ *
+ * Interactables with Batched Prompt Mode are not bound to any Widget. Instead, all of them are painted
+ * by single Slate Prompt Layer added to Player viewport, which is refilled every frame.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UActorInteractionPromptSubsystem : public ULocalPlayerSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+
+	/**
+	 * Binds pooled Widget to given Interactable and shows it.
+	 * Previously bound Interactable is unbound.
+	 *
+	 * @param Interactable		Interactable to show Prompt for.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void ShowPrompt(UActorInteractableComponentBase* Interactable);
+	/**
+	 * Hides pooled Widget if it is bound to given Interactable.
+	 *
+	 * @param Interactable		Interactable to hide Prompt for.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void HidePrompt(const UActorInteractableComponentBase* Interactable);
+	/**
+	 * Updates pooled Widget with data of given Interactable, if it is bound to it.
+	 *
+	 * @param Interactable		Interactable which data has changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void RefreshPrompt(UActorInteractableComponentBase* Interactable);
+
+	/**
+	 * Returns Interactable pooled Widget is bound to.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	UActorInteractableComponentBase* GetPromptInteractable() const
+	{ return PromptInteractable.Get(); };
+
+	/**
+	 * Returns Widget currently displaying Prompt.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	UUserWidget* GetPromptWidget() const
+	{ return ActiveWidget; };
+
+	/**
+	 * Returns Interactables currently painted by Prompt Layer.
+	 * Does not include Interactables found by Nearby Prompt Radius.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	TArray<UActorInteractableComponentBase*> GetBatchedInteractables() const;
+
+	/**
+	 * Sets radius around Player Pawn in which all triggerable Interactables with Batched Prompt Mode show their Prompt,
+	 * even if no Interactor has found them.
+	 * Value of 0 disables nearby Prompts.
+	 *
+	 * @param NewRadius		Radius in world units. Negative values are clamped to 0.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void SetNearbyPromptRadius(const float NewRadius);
+	/**
+	 * Returns radius around Player Pawn in which Batched Prompts are shown.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Interaction")
+	float GetNearbyPromptRadius() const
+	{ return NearbyPromptRadius; };
+
+protected:
+
+	/**
+	 * Returns pooled Widget of given class, creating it on first request.
+	 */
+	UUserWidget* AcquireWidget(const TSubclassOf<UUserWidget>& WidgetClass);
+
+	/**
+	 * Projects bound Interactable to screen and moves pooled Widget there.
+	 */
+	void UpdatePromptPosition() const;
+
+	/**
+	 * Adds Interactable to Prompt Layer, creating Prompt Layer on first request.
+	 */
+	void AddBatchedPrompt(UActorInteractableComponentBase* Interactable);
+	/**
+	 * Removes Interactable from Prompt Layer.
+	 */
+	void RemoveBatchedPrompt(const UActorInteractableComponentBase* Interactable);
+
+	/**
+	 * Adds Prompt Layer to viewport of Local Player if not added yet.
+	 */
+	void EnsurePromptLayer();
+	/**
+	 * Refills Prompt Layer records from batched and nearby Interactables.
+	 */
+	void UpdatePromptLayer();
+
+private:
+
+	/**
+	 * One Widget for each requested Widget Class.
+	 */
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UUserWidget>, UUserWidget*> PooledWidgets;
+
+	UPROPERTY(Transient)
+	UUserWidget* ActiveWidget = nullptr;
+
+	TWeakObjectPtr<UActorInteractableComponentBase> PromptInteractable;
+
+	/**
+	 * Interactables with Batched Prompt Mode which were found by Interactor.
+	 */
+	TArray<TWeakObjectPtr<UActorInteractableComponentBase>> BatchedInteractables;
+
+	/**
+	 * Reused for gathering nearby and batched Interactables each frame.
+	 */
+	TArray<UActorInteractableComponentBase*> VisibleInteractables;
+	/**
+	 * Batched Interactables of current frame, so nearby ones are deduplicated by hash lookup.
+	 * Reused each frame.
+	 */
+	TSet<const UActorInteractableComponentBase*> BatchedVisibleInteractables;
+
+	TSharedPtr<SInteractionPromptLayer> PromptLayer;
+
+	float NearbyPromptRadius = 0.f;
+};
@@ -0,0 +1,178 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorInteractionTimingSubsystem.generated.h"
+
+/**
+ * Handle of one Interaction Timer.
+ * Handle becomes stale once its Timer fires or is cleared, because Generation of the entry is increased.
+ */
+USTRUCT()
+struct FInteractionTimerHandle
+{
+	GENERATED_BODY()
+
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const
+	{ return Index != INDEX_NONE; };
+
+	void Invalidate()
+	{ Index = INDEX_NONE; Generation = 0; };
+
+	bool operator==(const FInteractionTimerHandle& Other) const
+	{ return Index == Other.Index && Generation == Other.Generation; };
+};
+
+/**
+ * One Timer stored in Timing Wheel.
+ * Entries live in pool and are linked into wheel slots by indices, so arming and cancelling never searches.
+ */
+struct FInteractionTimerEntry
+{
+	FSimpleDelegate Delegate;
+
+	double StartTime = 0.0;
+	double ExpirationTime = 0.0;
+
+	// Time remaining once Timer was paused
+	double PausedRemaining = 0.0;
+
+	int32 Slot = INDEX_NONE;
+	int32 Prev = INDEX_NONE;
+	int32 Next = INDEX_NONE;
+
+	// How many full wheel revolutions must pass before Timer fires
+	uint32 Rounds = 0;
+	uint32 Generation = 1;
+
+	uint8 bActive : 1;
+	uint8 bPaused : 1;
+
+	FInteractionTimerEntry() :
+	bActive(false),
+	bPaused(false)
+	{};
+};
+
+/**
+ * Actor Interaction Timing Subsystem
+ *
+ * World level Timing Wheel driving interaction, cooldown and expiration clocks of all Interactables.
+ * Timers are hashed into wheel slots by their expiration, so arming and cancelling is O(1)
+ * and each frame only visits slots which became due.
+ *
+ * Replaces per-Interactable Timer Manager handles, so Timer Manager heap does not grow with amount of Interactables.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UActorInteractionTimingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Arms Timer. If Handle is already armed, it is cleared first.
+	 *
+	 * @param InOutHandle	Handle to be set.
+	 * @param Delegate		Delegate executed once Timer fires.
+	 * @param Delay			Time in seconds until Timer fires. Timer fires on first wheel step after Delay elapsed.
+	 */
+	void SetTimer(FInteractionTimerHandle& InOutHandle, const FSimpleDelegate& Delegate, const float Delay);
+	/**
+	 * Cancels Timer and invalidates Handle.
+	 */
+	void ClearTimer(FInteractionTimerHandle& InOutHandle);
+	/**
+	 * Cancels all Timers bound to given Object.
+	 * Unlike other calls, this one iterates all Timers.
+	 */
+	void ClearAllTimersForObject(const UObject* Object);
+
+	/**
+	 * Removes Timer from wheel, keeping its remaining time.
+	 */
+	void PauseTimer(const FInteractionTimerHandle& Handle);
+	/**
+	 * Arms paused Timer again with its remaining time.
+	 */
+	void UnPauseTimer(const FInteractionTimerHandle& Handle);
+
+	bool IsTimerActive(const FInteractionTimerHandle& Handle) const;
+	bool IsTimerPaused(const FInteractionTimerHandle& Handle) const;
+	/**
+	 * Returns seconds since Timer was armed, excluding time spent paused.
+	 * Returns -1 if Handle is stale.
+	 */
+	float GetTimerElapsed(const FInteractionTimerHandle& Handle) const;
+	/**
+	 * Returns seconds until Timer fires.
+	 * Returns -1 if Handle is stale.
+	 */
+	float GetTimerRemaining(const FInteractionTimerHandle& Handle) const;
+
+	/**
+	 * Returns current time of Timing Wheel.
+	 * Advances with World time, stops while World is paused.
+	 */
+	double GetTime() const
+	{ return WheelTime; };
+
+	/**
+	 * Returns how many Timers are armed or paused.
+	 */
+	int32 GetNumTimers() const
+	{ return NumTimers; };
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	const FInteractionTimerEntry* FindEntry(const FInteractionTimerHandle& Handle) const;
+	FInteractionTimerEntry* FindEntry(const FInteractionTimerHandle& Handle);
+
+	void LinkEntry(const int32 EntryIndex, const double Delay);
+	void UnlinkEntry(const int32 EntryIndex);
+	void ReleaseEntry(const int32 EntryIndex);
+
+	/**
+	 * Advances wheel by one slot, firing all Timers which became due.
+	 */
+	void AdvanceSlot();
+
+private:
+
+	TArray<FInteractionTimerEntry> Entries;
+	TArray<int32> FreeEntries;
+
+	/**
+	 * First Entry of each wheel slot.
+	 */
+	TArray<int32> SlotHeads;
+
+	/**
+	 * Timers which became due during current step.
+	 * Handles are validated again before each Delegate is executed, so Timers cleared by earlier Delegates do not fire.
+	 */
+	TArray<FInteractionTimerHandle> DueTimers;
+
+	int32 CurrentSlot = 0;
+	int32 NumTimers = 0;
+
+	double WheelTime = 0.0;
+
+	/**
+	 * Time accumulated since last wheel step.
+	 */
+	double StepAccumulator = 0.0;
+};
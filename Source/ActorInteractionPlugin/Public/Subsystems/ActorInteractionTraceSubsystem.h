@@ -0,0 +1,209 @@
+// All rights reserved Dominik Pavlicek 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Components/ActorInteractorComponentTrace.h"
+#include "ActorInteractionTraceSubsystem.generated.h"
+
+/**
+ * Scheduling data of one registered Trace Interactor.
+ */
+struct FInteractionTraceSchedule
+{
+	TWeakObjectPtr<UActorInteractorComponentTrace> Interactor;
+	/**
+	 * Key of Interactor in Schedule Indices, still valid once Interactor is gone.
+	 */
+	TObjectKey<UActorInteractorComponentTrace> InteractorKey;
+	double NextTraceTime = 0.0;
+	/**
+	 * Position in Active Schedules, INDEX_NONE while paused.
+	 */
+	int32 ActiveIndex = INDEX_NONE;
+	uint8 bPaused : 1;
+
+	FInteractionTraceSchedule() :
+	bPaused(false)
+	{};
+
+	FInteractionTraceSchedule(UActorInteractorComponentTrace* NewInteractor, const double NewNextTraceTime) :
+	Interactor(NewInteractor),
+	InteractorKey(NewInteractor),
+	NextTraceTime(NewNextTraceTime),
+	bPaused(false)
+	{};
+};
+
+/**
+ * One query gathered during the current frame.
+ * Trace Data itself lives in Interactor's persistent Trace Buffer.
+ */
+struct FInteractionTraceRequest
+{
+	TWeakObjectPtr<UActorInteractorComponentTrace> Interactor;
+	int32 ScheduleIndex = INDEX_NONE;
+	bool bResultsReady = false;
+
+	FInteractionTraceRequest()
+	{};
+
+	FInteractionTraceRequest(UActorInteractorComponentTrace* NewInteractor, const int32 NewScheduleIndex) :
+	Interactor(NewInteractor),
+	ScheduleIndex(NewScheduleIndex)
+	{};
+};
+
+/**
+ * Actor Interaction Trace Subsystem
+ *
+ * World level scheduler owning all Trace Interactors.
+ * Once per frame it gathers query descriptors from every Interactor whose Trace Interval has elapsed,
+ * issues all queries in one batch and then dispatches results back to their Interactors.
+ *
+ * Replaces per-Interactor Timers, so Timer Manager is not re-armed for every single trace.
+ *
+ * Newly registered Interactors get staggered phase offsets, so many Interactors starting in the same frame
+ * spread their traces over their interval. Global per-frame budget is set by `Mountea.Interaction.TraceBudgetPerFrame`.
+ *
+ * Interactors with Significance Provider are evaluated every `Mountea.Interaction.SignificanceUpdateInterval` seconds.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UActorInteractionTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UActorInteractionTraceSubsystem();
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Registers Trace Interactor. First trace will be processed once its Trace Interval elapses.
+	 * If already registered, Interactor is only resumed.
+	 *
+	 * @param Interactor	Interactor to be registered. Null is not allowed.
+	 */
+	void RegisterInteractor(UActorInteractorComponentTrace* Interactor);
+	/**
+	 * Unregisters Trace Interactor. No more traces will be processed for it.
+	 *
+	 * @param Interactor	Interactor to be unregistered.
+	 */
+	void UnregisterInteractor(const UActorInteractorComponentTrace* Interactor);
+	/**
+	 * Pauses or resumes tracing for registered Interactor without losing its schedule.
+	 *
+	 * @param Interactor	Registered Interactor.
+	 * @param bPaused		Whether tracing should be paused.
+	 */
+	void SetInteractorPaused(const UActorInteractorComponentTrace* Interactor, const bool bPaused);
+
+	/**
+	 * Returns whether Interactor is registered and not paused.
+	 */
+	bool IsInteractorTracing(const UActorInteractorComponentTrace* Interactor) const;
+	/**
+	 * Returns whether Interactor is registered and paused.
+	 */
+	bool IsInteractorPaused(const UActorInteractorComponentTrace* Interactor) const;
+
+	/**
+	 * Returns how many Trace Interactors are registered.
+	 */
+	int32 GetNumRegisteredInteractors() const
+	{ return Schedules.Num(); };
+
+	/**
+	 * Returns how many queries were issued during last processed frame.
+	 */
+	int32 GetNumQueriesLastFrame() const
+	{ return NumQueriesLastFrame; };
+
+	/**
+	 * Returns running variance of queries issued per frame.
+	 * Low value means trace work is spread evenly across frames.
+	 */
+	float GetTraceQueriesVariance() const
+	{ return TraceQueriesVariance; };
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	FInteractionTraceSchedule* FindSchedule(const UActorInteractorComponentTrace* Interactor);
+	const FInteractionTraceSchedule* FindSchedule(const UActorInteractorComponentTrace* Interactor) const;
+
+	/**
+	 * Returns Interactor of Request, unless it was unregistered, paused or can no longer trace since Request was gathered.
+	 */
+	UActorInteractorComponentTrace* GetRequestInteractor(const FInteractionTraceRequest& Request) const;
+
+private:
+
+	void AddActiveSchedule(const int32 ScheduleIndex);
+	void RemoveActiveSchedule(const int32 ScheduleIndex);
+	/**
+	 * Removes Schedule, moving last Schedule into its place and updating indices pointing to it.
+	 */
+	void RemoveScheduleAt(const int32 ScheduleIndex);
+	/**
+	 * Removes Schedules of Interactors which were unregistered while processing frame or destroyed.
+	 */
+	void RemoveStaleSchedules();
+
+private:
+
+	TArray<FInteractionTraceSchedule> Schedules;
+
+	/**
+	 * Index of Schedule of each registered Interactor.
+	 */
+	TMap<TObjectKey<UActorInteractorComponentTrace>, int32> ScheduleIndices;
+
+	/**
+	 * Indices of Schedules which are not paused. Only these are visited when gathering queries.
+	 */
+	TArray<int32> ActiveSchedules;
+
+	/**
+	 * Indices of Schedules which are due in current frame.
+	 * Sorted by Next Trace Time only once Trace Budget is exceeded.
+	 */
+	TArray<int32> DueSchedules;
+	
+	/**
+	 * Requests gathered for current frame.
+	 */
+	TArray<FInteractionTraceRequest> PendingRequests;
+
+	int32 NumQueriesLastFrame = 0;
+
+	double NextSignificanceUpdateTime = 0.0;
+
+	float TraceQueriesMean = 0.f;
+	float TraceQueriesVariance = 0.f;
+
+	/**
+	 * How many phase offsets were assigned so far.
+	 */
+	uint32 NumPhaseOffsets = 0;
+
+	/**
+	 * Set while frame is being processed.
+	 * Interactors unregistered meanwhile are only invalidated and removed once frame is finished.
+	 */
+	uint8 bProcessingFrame : 1;
+
+	/**
+	 * Set once any Schedule lost its Interactor, so stale Schedules are only searched for when there are some.
+	 */
+	uint8 bHasStaleSchedules : 1;
+};
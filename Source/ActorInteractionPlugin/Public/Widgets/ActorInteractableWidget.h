@@ -81,6 +81,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interaction")
 	void SetInteractionProgress(float NewInteractionProgress);
 
+	/**
+	 * Sets timing used to interpolate Interaction Progress locally.
+	 * While Progress Rate is 0, Widget does no per-frame work.
+	 * 
+	 * @param Timestamp		World Time at which Progress was sampled.
+	 * @param Progress		Interaction Progress at Timestamp.
+	 * @param NewProgressRate	Progress gained each second.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void SetInteractionProgressTiming(const float Timestamp, const float Progress, const float NewProgressRate);
+
 	/**
 	 * Whenever Interaction Progress is updated, this event will be called.
 	 * This event should be responsible for visual updates of any progress bars/animations.
@@ -176,5 +187,9 @@ private:
 
 	float TimeRemainder;
 
+	float ProgressTimestamp = 0.f;
+	float ProgressAtTimestamp = 0.f;
+	float ProgressRate = 0.f;
+
 
 };